@@ -0,0 +1,58 @@
+#include <benchmark/benchmark.h>
+
+#include "simlab/core/Automata.hpp"
+#include "simlab/core/Random.hpp"
+
+#include <vector>
+
+namespace {
+
+    constexpr std::uint64_t Seed = 42;
+
+    // range(0) x range(0) cells
+    void BM_LifeStepConway(benchmark::State& state) {
+        auto size = static_cast<int>(state.range(0));
+        auto grid = simlab::Automata::randomGrid(size, 0.25F, Seed);
+        simlab::Automata::Grid next;
+
+        for (auto _ : state) {
+            simlab::Automata::lifeStep(grid, next,
+                                       simlab::LifeRule::conway());
+            grid.swap(next);
+        }
+        state.SetItemsProcessed(state.iterations() * size * size);
+    }
+    BENCHMARK(BM_LifeStepConway)->RangeMultiplier(4)->Range(32, 2048);
+
+    void BM_LifeStepMaze(benchmark::State& state) {
+        auto size = static_cast<int>(state.range(0));
+        auto grid = simlab::Automata::randomGrid(size, 0.12F, Seed);
+        simlab::Automata::Grid next;
+
+        for (auto _ : state) {
+            simlab::Automata::lifeStep(grid, next, simlab::LifeRule::maze());
+            grid.swap(next);
+        }
+        state.SetItemsProcessed(state.iterations() * size * size);
+    }
+    BENCHMARK(BM_LifeStepMaze)->RangeMultiplier(4)->Range(32, 2048);
+
+    void BM_ElementaryRule30(benchmark::State& state) {
+        auto           width = state.range(0);
+        simlab::Random random(7);
+
+        std::vector<bool> states(width);
+        std::vector<bool> next;
+        for (auto&& cell : states) {
+            cell = random.chance(0.1);
+        }
+
+        for (auto _ : state) {
+            simlab::Automata::elementaryStep(30, states, next);
+            states.swap(next);
+        }
+        state.SetItemsProcessed(state.iterations() * width);
+    }
+    BENCHMARK(BM_ElementaryRule30)->RangeMultiplier(8)->Range(64, 1 << 18);
+
+}  // namespace
@@ -0,0 +1,121 @@
+#include <benchmark/benchmark.h>
+
+#include "fixtures.hpp"
+#include "simlab/core/BatchMath.hpp"
+#include "simlab/core/utils.hpp"
+
+#include <vector>
+
+namespace {
+
+    using simlab::BatchMath;
+
+    constexpr float Dt     = 1.F / 120.F;
+    constexpr float Width  = 1280.F;
+    constexpr float Height = 720.F;
+
+    struct Bodies {
+        std::vector<float> x, y, vx, vy, nx, ny;
+    };
+
+    auto randomBodies(std::size_t count, std::uint64_t seed) -> Bodies {
+        simlab::Random random(seed);
+
+        Bodies bodies;
+        bodies.x  = fixtures::uniformValues(count, 0.F, Width, random);
+        bodies.y  = fixtures::uniformValues(count, 0.F, Height, random);
+        bodies.vx = fixtures::uniformValues(count, -300.F, 300.F, random);
+        bodies.vy = fixtures::uniformValues(count, -300.F, 300.F, random);
+
+        auto normals = fixtures::uniformVectors(count, -1.F, 1.F, random);
+        bodies.nx.resize(count);
+        bodies.ny.resize(count);
+        for (std::size_t i = 0; i < count; i++) {
+            auto normal  = utils::normalize(normals[i]);
+            bodies.nx[i] = normal.x;
+            bodies.ny[i] = normal.y;
+        }
+        return bodies;
+    }
+
+    // range(0) bodies, range(1) a BatchMath::Isa; skipped when unsupported
+    auto useIsa(benchmark::State& state) -> bool {
+        auto isa = static_cast<BatchMath::Isa>(state.range(1));
+        if (!BatchMath::isSupported(isa)) {
+            state.SkipWithError("instruction set not supported");
+            return false;
+        }
+        BatchMath::setIsa(isa);
+        state.SetLabel(BatchMath::getIsaName(isa));
+        return true;
+    }
+
+    // Integrate, reflect and clamp one vector at a time with utils::
+    void BM_StepPerElement(benchmark::State& state) {
+        auto count = static_cast<std::size_t>(state.range(0));
+        std::vector<sf::Vector2f> positions(count);
+        std::vector<sf::Vector2f> velocities(count);
+        std::vector<sf::Vector2f> normals(count);
+        Bodies bodies = randomBodies(count, 1);
+        for (std::size_t i = 0; i < count; i++) {
+            positions[i]  = {bodies.x[i], bodies.y[i]};
+            velocities[i] = {bodies.vx[i], bodies.vy[i]};
+            normals[i]    = {bodies.nx[i], bodies.ny[i]};
+        }
+
+        for (auto _ : state) {
+            for (std::size_t i = 0; i < count; i++) {
+                velocities[i] = utils::reflect(velocities[i], normals[i]);
+                positions[i] += velocities[i] * Dt;
+                positions[i].x = std::clamp(positions[i].x, 0.F, Width);
+                positions[i].y = std::clamp(positions[i].y, 0.F, Height);
+            }
+            benchmark::DoNotOptimize(positions.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(BM_StepPerElement)->RangeMultiplier(10)->Range(1000, 100000);
+
+    // The same step as four BatchMath loops
+    void BM_StepBatch(benchmark::State& state) {
+        if (!useIsa(state)) {
+            return;
+        }
+        auto   count  = static_cast<std::size_t>(state.range(0));
+        Bodies bodies = randomBodies(count, 1);
+
+        for (auto _ : state) {
+            BatchMath::reflect(bodies.vx.data(), bodies.vy.data(),
+                               bodies.nx.data(), bodies.ny.data(), count);
+            BatchMath::axpy(Dt, bodies.vx.data(), bodies.x.data(), count);
+            BatchMath::axpy(Dt, bodies.vy.data(), bodies.y.data(), count);
+            BatchMath::clampToRect(bodies.x.data(), bodies.y.data(), 0.F,
+                                   0.F, Width, Height, count);
+            benchmark::DoNotOptimize(bodies.x.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(BM_StepBatch)
+        ->ArgsProduct({{1000, 10000, 100000}, {0, 1, 2}});
+
+    void BM_NormalizeBatch(benchmark::State& state) {
+        if (!useIsa(state)) {
+            return;
+        }
+        auto   count  = static_cast<std::size_t>(state.range(0));
+        Bodies bodies = randomBodies(count, 2);
+
+        for (auto _ : state) {
+            // Normalizing unit vectors again keeps the data stable
+            BatchMath::normalize(bodies.vx.data(), bodies.vy.data(), count);
+            benchmark::DoNotOptimize(bodies.vx.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(BM_NormalizeBatch)
+        ->ArgsProduct({{1000, 10000, 100000}, {0, 1, 2}});
+
+}  // namespace
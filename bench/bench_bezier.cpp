@@ -0,0 +1,72 @@
+#include <benchmark/benchmark.h>
+
+#include "simlab/drawables/BezierCurve.hpp"
+
+#include <cmath>
+#include <vector>
+
+namespace {
+
+    auto zigzag(std::size_t count) -> std::vector<sf::Vector2f> {
+        std::vector<sf::Vector2f> points(count);
+        for (std::size_t i = 0; i < count; i++) {
+            points[i] = {static_cast<float>(i) * 40.F,
+                         (i % 2 == 0) ? 0.F : 300.F};
+        }
+        return points;
+    }
+
+    /**
+     * @brief Full curve re-evaluation after moving one control point
+     * range(0) control points, range(1) curve samples
+     */
+    void BM_BezierEvaluate(benchmark::State& state) {
+        auto points  = zigzag(static_cast<std::size_t>(state.range(0)));
+        auto samples = static_cast<double>(state.range(1));
+        Drawables::BezierCurve curve(points, 1.0 / samples);
+
+        float offset = 0.F;
+        for (auto _ : state) {
+            offset = offset > 10.F ? 0.F : offset + 1.F;
+            curve.setControlPoint(0, {offset, offset});
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(1));
+    }
+    BENCHMARK(BM_BezierEvaluate)
+        ->ArgsProduct({{3, 4, 8, 16}, {20, 100, 1000}});
+
+    // Single-point queries; range(0) control points
+    void BM_BezierPoint(benchmark::State& state) {
+        auto points = zigzag(static_cast<std::size_t>(state.range(0)));
+        Drawables::BezierCurve curve(points);
+
+        float t = 0.F;
+        for (auto _ : state) {
+            t = t >= 1.F ? 0.F : t + 0.001F;
+            benchmark::DoNotOptimize(curve.evaluate(t));
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+    BENCHMARK(BM_BezierPoint)->Arg(3)->Arg(4)->Arg(8)->Arg(16);
+
+    /**
+     * @brief Adaptive flattening after moving one control point
+     * range(0) control points, range(1) tolerance in hundredths of a pixel
+     */
+    void BM_BezierFlatten(benchmark::State& state) {
+        auto points = zigzag(static_cast<std::size_t>(state.range(0)));
+        Drawables::BezierCurve curve(points);
+        curve.setTolerance(static_cast<float>(state.range(1)) / 100.F);
+        curve.enableAdaptive(true);
+
+        float offset = 0.F;
+        for (auto _ : state) {
+            offset = offset > 10.F ? 0.F : offset + 1.F;
+            curve.setControlPoint(0, {offset, offset});
+        }
+        state.counters["vertices"] =
+            static_cast<double>(curve.getCurveVertexCount());
+    }
+    BENCHMARK(BM_BezierFlatten)->ArgsProduct({{3, 4, 8, 16}, {10, 25, 100}});
+
+}  // namespace
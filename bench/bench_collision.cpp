@@ -0,0 +1,95 @@
+#include <benchmark/benchmark.h>
+
+#include "fixtures.hpp"
+#include "simlab/core/Collision.hpp"
+
+#include <cmath>
+#include <vector>
+
+namespace {
+
+    // count circles scattered so that roughly half the neighbours overlap
+    auto randomCircles(std::size_t count, std::uint64_t seed)
+        -> std::vector<sf::CircleShape> {
+        simlab::Random random(seed);
+
+        auto radii     = fixtures::uniformValues(count, 5.F, 15.F, random);
+        auto positions = fixtures::uniformVectors(count, 0.F, 200.F, random);
+
+        std::vector<sf::CircleShape> circles(count);
+        for (std::size_t i = 0; i < count; i++) {
+            circles[i].setRadius(radii[i]);
+            circles[i].setPosition(positions[i]);
+        }
+        return circles;
+    }
+
+    auto regularPolygon(std::size_t sides, sf::Vector2f center, float radius)
+        -> std::vector<sf::Vector2f> {
+        std::vector<sf::Vector2f> points(sides);
+        for (std::size_t i = 0; i < sides; i++) {
+            float angle = 2.F * static_cast<float>(M_PI) *
+                          static_cast<float>(i) / static_cast<float>(sides);
+            points[i]   = center + (radius * sf::Vector2f(std::cos(angle),
+                                                          std::sin(angle)));
+        }
+        return points;
+    }
+
+    void BM_CircleCollision(benchmark::State& state) {
+        auto count   = static_cast<std::size_t>(state.range(0));
+        auto circles = randomCircles(count + 1, 1);
+
+        for (auto _ : state) {
+            int hits = 0;
+            for (std::size_t i = 0; i < count; i++) {
+                hits += static_cast<int>(simlab::Collision::circleCollision(
+                                             circles[i], circles[i + 1])
+                                             .collided);
+            }
+            benchmark::DoNotOptimize(hits);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(BM_CircleCollision)->RangeMultiplier(8)->Range(64, 1 << 16);
+
+    // Includes restoring positions and velocities each iteration
+    void BM_ElasticCollisionAdvanced(benchmark::State& state) {
+        auto count    = static_cast<std::size_t>(state.range(0));
+        auto initial  = randomCircles(count + 1, 2);
+        auto circles  = initial;
+        auto velocity = std::vector<sf::Vector2f>(count + 1, {30.F, -10.F});
+
+        for (auto _ : state) {
+            for (std::size_t i = 0; i <= count; i++) {
+                circles[i].setPosition(initial[i].getPosition());
+                velocity[i] = {30.F, -10.F};
+            }
+            for (std::size_t i = 0; i < count; i++) {
+                simlab::Collision::elasticCollisionAdvanced(
+                    circles[i], circles[i + 1], velocity[i], velocity[i + 1],
+                    0.9F, 0.1F);
+            }
+            benchmark::DoNotOptimize(velocity.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(BM_ElasticCollisionAdvanced)
+        ->RangeMultiplier(8)
+        ->Range(64, 1 << 16);
+
+    // Overlapping regular polygons with range(0) vertices each
+    void BM_PolygonsIntersect(benchmark::State& state) {
+        auto sides = static_cast<std::size_t>(state.range(0));
+        auto poly1 = regularPolygon(sides, {0.F, 0.F}, 50.F);
+        auto poly2 = regularPolygon(sides, {60.F, 10.F}, 50.F);
+
+        for (auto _ : state) {
+            auto info = simlab::Collision::polygonsIntersect(poly1, poly2);
+            benchmark::DoNotOptimize(info);
+        }
+    }
+    BENCHMARK(BM_PolygonsIntersect)->RangeMultiplier(2)->Range(3, 64);
+
+}  // namespace
@@ -0,0 +1,78 @@
+#include <benchmark/benchmark.h>
+
+#include "simlab/core/Palette.hpp"
+#include "simlab/core/utils.hpp"
+
+#include <vector>
+
+namespace {
+
+    auto hueRamp(std::size_t count) -> std::vector<float> {
+        std::vector<float> hues(count);
+        for (std::size_t i = 0; i < count; i++) {
+            hues[i] = static_cast<float>(i) / static_cast<float>(count);
+        }
+        return hues;
+    }
+
+    void BM_HSVtoRGB(benchmark::State& state) {
+        auto                   hues = hueRamp(state.range(0));
+        std::vector<sf::Color> out(hues.size());
+
+        for (auto _ : state) {
+            for (std::size_t i = 0; i < hues.size(); i++) {
+                out[i] = utils::HSVtoRGB(hues[i], 1.F, 1.F);
+            }
+            benchmark::DoNotOptimize(out.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(BM_HSVtoRGB)->RangeMultiplier(8)->Range(64, 1 << 18);
+
+    void BM_HSLtoRGB(benchmark::State& state) {
+        auto                   hues = hueRamp(state.range(0));
+        std::vector<sf::Color> out(hues.size());
+
+        for (auto _ : state) {
+            for (std::size_t i = 0; i < hues.size(); i++) {
+                out[i] = utils::HSLtoRGB(hues[i], 1.F, 0.5F);
+            }
+            benchmark::DoNotOptimize(out.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(BM_HSLtoRGB)->RangeMultiplier(8)->Range(64, 1 << 18);
+
+    void BM_PaletteLookup(benchmark::State& state) {
+        auto                   hues    = hueRamp(state.range(0));
+        auto                   palette = simlab::Palette::hsv();
+        std::vector<sf::Color> out(hues.size());
+
+        for (auto _ : state) {
+            for (std::size_t i = 0; i < hues.size(); i++) {
+                out[i] = palette(hues[i]);
+            }
+            benchmark::DoNotOptimize(out.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(BM_PaletteLookup)->RangeMultiplier(8)->Range(64, 1 << 18);
+
+    void BM_PaletteMap(benchmark::State& state) {
+        auto                   hues    = hueRamp(state.range(0));
+        auto                   palette = simlab::Palette::viridis();
+        std::vector<sf::Color> out(hues.size());
+
+        for (auto _ : state) {
+            palette.map(hues.data(), out.data(), hues.size());
+            benchmark::DoNotOptimize(out.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(BM_PaletteMap)->RangeMultiplier(8)->Range(64, 1 << 18);
+
+}  // namespace
@@ -0,0 +1,154 @@
+#include <benchmark/benchmark.h>
+
+#include "fixtures.hpp"
+#include "simlab/core/FastMath.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace {
+
+    namespace fastmath = simlab::fastmath;
+
+    constexpr std::size_t Count = 1 << 14;
+
+    auto uniform(float lo, float hi, std::uint64_t seed)
+        -> std::vector<float> {
+        return fixtures::uniformValues(Count, lo, hi, seed);
+    }
+
+    // Worst error of approx against exact over the inputs, reported next
+    // to the timing so the tradeoff reads off one line
+    template <typename Approx, typename Exact>
+    void reportError(benchmark::State& state, const std::vector<float>& in,
+                     Approx approx, Exact exact, bool relative) {
+        double worst = 0.0;
+        for (float x : in) {
+            double want = exact(static_cast<double>(x));
+            double err  = std::fabs(approx(x) - want);
+            worst = std::max(worst, relative ? err / std::fabs(want) : err);
+        }
+        state.counters["max_err"] = worst;
+    }
+
+    template <typename Fn>
+    void runUnary(benchmark::State& state, const std::vector<float>& in,
+                  Fn fn) {
+        std::vector<float> out(in.size());
+        for (auto _ : state) {
+            for (std::size_t i = 0; i < in.size(); i++) {
+                out[i] = fn(in[i]);
+            }
+            benchmark::DoNotOptimize(out.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * in.size());
+    }
+
+    void BM_RsqrtStd(benchmark::State& state) {
+        auto in = uniform(1e-3F, 1e6F, 1);
+        runUnary(state, in, [](float x) { return 1.F / std::sqrt(x); });
+    }
+    BENCHMARK(BM_RsqrtStd);
+
+    void BM_RsqrtFast(benchmark::State& state) {
+        auto in = uniform(1e-3F, 1e6F, 1);
+        runUnary(state, in, fastmath::rsqrt);
+        reportError(
+            state, in, fastmath::rsqrt,
+            [](double x) { return 1.0 / std::sqrt(x); }, true);
+    }
+    BENCHMARK(BM_RsqrtFast);
+
+    void BM_SinCosStd(benchmark::State& state) {
+        auto               in = uniform(-100.F, 100.F, 2);
+        std::vector<float> sn(in.size());
+        std::vector<float> cs(in.size());
+        for (auto _ : state) {
+            for (std::size_t i = 0; i < in.size(); i++) {
+                sn[i] = std::sin(in[i]);
+                cs[i] = std::cos(in[i]);
+            }
+            benchmark::DoNotOptimize(sn.data());
+            benchmark::DoNotOptimize(cs.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * in.size());
+    }
+    BENCHMARK(BM_SinCosStd);
+
+    void BM_SinCosFast(benchmark::State& state) {
+        auto               in = uniform(-100.F, 100.F, 2);
+        std::vector<float> sn(in.size());
+        std::vector<float> cs(in.size());
+        for (auto _ : state) {
+            for (std::size_t i = 0; i < in.size(); i++) {
+                fastmath::sincos(in[i], sn[i], cs[i]);
+            }
+            benchmark::DoNotOptimize(sn.data());
+            benchmark::DoNotOptimize(cs.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * in.size());
+        reportError(
+            state, in, fastmath::sin, [](double x) { return std::sin(x); },
+            false);
+    }
+    BENCHMARK(BM_SinCosFast);
+
+    void BM_Atan2Std(benchmark::State& state) {
+        auto               ys = uniform(-1.F, 1.F, 3);
+        auto               xs = uniform(-1.F, 1.F, 4);
+        std::vector<float> out(ys.size());
+        for (auto _ : state) {
+            for (std::size_t i = 0; i < ys.size(); i++) {
+                out[i] = std::atan2(ys[i], xs[i]);
+            }
+            benchmark::DoNotOptimize(out.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * ys.size());
+    }
+    BENCHMARK(BM_Atan2Std);
+
+    void BM_Atan2Fast(benchmark::State& state) {
+        auto               ys = uniform(-1.F, 1.F, 3);
+        auto               xs = uniform(-1.F, 1.F, 4);
+        std::vector<float> out(ys.size());
+        for (auto _ : state) {
+            for (std::size_t i = 0; i < ys.size(); i++) {
+                out[i] = fastmath::atan2(ys[i], xs[i]);
+            }
+            benchmark::DoNotOptimize(out.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * ys.size());
+
+        double worst = 0.0;
+        for (std::size_t i = 0; i < ys.size(); i++) {
+            double want = std::atan2(static_cast<double>(ys[i]),
+                                     static_cast<double>(xs[i]));
+            worst = std::max(worst,
+                             std::fabs(fastmath::atan2(ys[i], xs[i]) - want));
+        }
+        state.counters["max_err"] = worst;
+    }
+    BENCHMARK(BM_Atan2Fast);
+
+    void BM_AcosStd(benchmark::State& state) {
+        auto in = uniform(-1.F, 1.F, 5);
+        runUnary(state, in, [](float x) { return std::acos(x); });
+    }
+    BENCHMARK(BM_AcosStd);
+
+    void BM_AcosFast(benchmark::State& state) {
+        auto in = uniform(-1.F, 1.F, 5);
+        runUnary(state, in, fastmath::acos);
+        reportError(
+            state, in, fastmath::acos, [](double x) { return std::acos(x); },
+            false);
+    }
+    BENCHMARK(BM_AcosFast);
+
+}  // namespace
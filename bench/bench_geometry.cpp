@@ -0,0 +1,48 @@
+#include <benchmark/benchmark.h>
+
+#include "fixtures.hpp"
+#include "simlab/core/Geometry.hpp"
+#include "simlab/core/utils.hpp"
+
+#include <vector>
+
+namespace {
+
+    // One sf::VertexArray per circle, as utils::GenerateCircle returns
+    void BM_GenerateCircle(benchmark::State& state) {
+        auto centers = fixtures::uniformVectors(
+            static_cast<std::size_t>(state.range(0)), 0.F, 1000.F, 9);
+
+        for (auto _ : state) {
+            for (const auto& center : centers) {
+                auto circle =
+                    utils::GenerateCircle(center, 4.F, sf::Color::White);
+                benchmark::DoNotOptimize(circle.getVertexCount());
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(BM_GenerateCircle)->RangeMultiplier(10)->Range(1000, 100000);
+
+    // Every circle into one reused buffer from the cached unit circle
+    void BM_WriteCircles(benchmark::State& state) {
+        auto centers = fixtures::uniformVectors(
+            static_cast<std::size_t>(state.range(0)), 0.F, 1000.F, 9);
+        const auto&             unit = simlab::Geometry::unitCircle();
+        std::vector<sf::Vertex> vertices(
+            centers.size() * simlab::Geometry::circleVertexCount());
+
+        for (auto _ : state) {
+            sf::Vertex* out = vertices.data();
+            for (const auto& center : centers) {
+                out = simlab::Geometry::writeCircle(out, unit, center, 4.F,
+                                                    sf::Color::White);
+            }
+            benchmark::DoNotOptimize(vertices.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(BM_WriteCircles)->RangeMultiplier(10)->Range(1000, 100000);
+
+}  // namespace
@@ -0,0 +1,104 @@
+#include <benchmark/benchmark.h>
+
+#include "simlab/core/Random.hpp"
+
+#include <random>
+#include <vector>
+
+namespace {
+
+    using simlab::Random;
+
+    constexpr std::uint64_t Seed = 42;
+
+    void BM_Mt19937Uniform(benchmark::State& state) {
+        std::mt19937                          generator(Seed);
+        std::uniform_real_distribution<float> dist(0.F, 1.F);
+        std::vector<float>                    out(state.range(0));
+
+        for (auto _ : state) {
+            for (auto& v : out) {
+                v = dist(generator);
+            }
+            benchmark::DoNotOptimize(out.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(BM_Mt19937Uniform)->Range(64, 1 << 16);
+
+    void BM_RandomUniform(benchmark::State& state) {
+        Random             random(Seed);
+        std::vector<float> out(state.range(0));
+
+        for (auto _ : state) {
+            for (auto& v : out) {
+                v = random.uniform(0.F, 1.F);
+            }
+            benchmark::DoNotOptimize(out.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(BM_RandomUniform)->Range(64, 1 << 16);
+
+    void BM_RandomFillUniform(benchmark::State& state) {
+        Random             random(Seed);
+        std::vector<float> out(state.range(0));
+
+        for (auto _ : state) {
+            random.fillUniform(out.data(), out.size());
+            benchmark::DoNotOptimize(out.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(BM_RandomFillUniform)->Range(64, 1 << 16);
+
+    void BM_Mt19937Normal(benchmark::State& state) {
+        std::mt19937                    generator(Seed);
+        std::normal_distribution<float> dist(0.F, 1.F);
+        std::vector<float>              out(state.range(0));
+
+        for (auto _ : state) {
+            for (auto& v : out) {
+                v = dist(generator);
+            }
+            benchmark::DoNotOptimize(out.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(BM_Mt19937Normal)->Range(64, 1 << 16);
+
+    void BM_RandomFillNormal(benchmark::State& state) {
+        Random             random(Seed);
+        std::vector<float> out(state.range(0));
+
+        for (auto _ : state) {
+            random.fillNormal(out.data(), out.size());
+            benchmark::DoNotOptimize(out.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(BM_RandomFillNormal)->Range(64, 1 << 16);
+
+    // Phyllotaxis used to build one of these for every point it placed
+    void BM_Mt19937Construct(benchmark::State& state) {
+        for (auto _ : state) {
+            std::mt19937 generator(Seed);
+            benchmark::DoNotOptimize(generator());
+        }
+    }
+    BENCHMARK(BM_Mt19937Construct);
+
+    void BM_RandomConstruct(benchmark::State& state) {
+        for (auto _ : state) {
+            Random random(Seed);
+            benchmark::DoNotOptimize(random());
+        }
+    }
+    BENCHMARK(BM_RandomConstruct);
+
+}  // namespace
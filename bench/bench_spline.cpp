@@ -0,0 +1,55 @@
+#include <benchmark/benchmark.h>
+
+#include "simlab/drawables/SplineCurve.hpp"
+
+#include <cmath>
+#include <vector>
+
+namespace {
+
+    using Drawables::SplineCurve;
+
+    auto wave(std::size_t count) -> std::vector<sf::Vector2f> {
+        std::vector<sf::Vector2f> points(count);
+        for (std::size_t i = 0; i < count; i++) {
+            auto x    = static_cast<float>(i) * 4.F;
+            points[i] = {x, 300.F * std::sin(x / 80.F)};
+        }
+        return points;
+    }
+
+    /**
+     * @brief Dragging one point in the middle of a long path
+     * range(0) control points, range(1) the SplineCurve::Type
+     */
+    void BM_SplineEdit(benchmark::State& state) {
+        auto        points = wave(static_cast<std::size_t>(state.range(0)));
+        SplineCurve spline(points,
+                           static_cast<SplineCurve::Type>(state.range(1)));
+
+        std::size_t  middle = points.size() / 2;
+        sf::Vector2f point  = points[middle];
+        float        offset = 0.F;
+        for (auto _ : state) {
+            offset = offset > 10.F ? 0.F : offset + 1.F;
+            spline.setControlPoint(middle, {point.x, point.y + offset});
+        }
+        state.SetItemsProcessed(state.iterations());
+        state.counters["vertices"] =
+            static_cast<double>(spline.getCurveVertexCount());
+    }
+    BENCHMARK(BM_SplineEdit)->ArgsProduct({{64, 1024, 16384}, {0, 1, 2}});
+
+    // Whole-path rebuild, what every edit would cost without local support
+    void BM_SplineRebuild(benchmark::State& state) {
+        auto        points = wave(static_cast<std::size_t>(state.range(0)));
+        SplineCurve spline(points);
+
+        for (auto _ : state) {
+            spline.setControlPoints(points);
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+    BENCHMARK(BM_SplineRebuild)->Arg(64)->Arg(1024)->Arg(16384);
+
+}  // namespace
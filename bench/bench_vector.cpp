@@ -0,0 +1,61 @@
+#include <benchmark/benchmark.h>
+
+#include "fixtures.hpp"
+#include "simlab/core/utils.hpp"
+
+#include <vector>
+
+namespace {
+
+    void BM_Magnitude(benchmark::State& state) {
+        auto count   = static_cast<std::size_t>(state.range(0));
+        auto vectors = fixtures::uniformVectors(count, -100.F, 100.F, 1);
+
+        for (auto _ : state) {
+            float sum = 0.F;
+            for (const auto& v : vectors) {
+                sum += utils::magnitude(v);
+            }
+            benchmark::DoNotOptimize(sum);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(BM_Magnitude)->RangeMultiplier(8)->Range(64, 1 << 18);
+
+    void BM_Normalize(benchmark::State& state) {
+        auto count   = static_cast<std::size_t>(state.range(0));
+        auto vectors = fixtures::uniformVectors(count, -100.F, 100.F, 2);
+        std::vector<sf::Vector2f> out(count);
+
+        for (auto _ : state) {
+            for (std::size_t i = 0; i < count; i++) {
+                out[i] = utils::normalize(vectors[i]);
+            }
+            benchmark::DoNotOptimize(out.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(BM_Normalize)->RangeMultiplier(8)->Range(64, 1 << 18);
+
+    void BM_Reflect(benchmark::State& state) {
+        auto count   = static_cast<std::size_t>(state.range(0));
+        auto vectors = fixtures::uniformVectors(count, -100.F, 100.F, 3);
+        auto normals = fixtures::uniformVectors(count, -100.F, 100.F, 4);
+        for (auto& n : normals) {
+            n = utils::normalize(n);
+        }
+        std::vector<sf::Vector2f> out(count);
+
+        for (auto _ : state) {
+            for (std::size_t i = 0; i < count; i++) {
+                out[i] = utils::reflect(vectors[i], normals[i]);
+            }
+            benchmark::DoNotOptimize(out.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(BM_Reflect)->RangeMultiplier(8)->Range(64, 1 << 18);
+
+}  // namespace
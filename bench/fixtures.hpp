@@ -0,0 +1,48 @@
+#pragma once
+
+#include <SFML/System/Vector2.hpp>
+
+#include "simlab/core/Random.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Seeded input data shared by the microbenchmarks
+namespace fixtures {
+
+    // count values uniform in [lo, hi)
+    inline auto uniformValues(std::size_t count, float lo, float hi,
+                              simlab::Random& random) -> std::vector<float> {
+        std::vector<float> values(count);
+        random.fillUniform(values.data(), count, lo, hi);
+        return values;
+    }
+
+    inline auto uniformValues(std::size_t count, float lo, float hi,
+                              std::uint64_t seed) -> std::vector<float> {
+        simlab::Random random(seed);
+        return uniformValues(count, lo, hi, random);
+    }
+
+    // count vectors with both components uniform in [lo, hi)
+    inline auto uniformVectors(std::size_t count, float lo, float hi,
+                               simlab::Random& random)
+        -> std::vector<sf::Vector2f> {
+        auto values = uniformValues(2 * count, lo, hi, random);
+
+        std::vector<sf::Vector2f> vectors(count);
+        for (std::size_t i = 0; i < count; i++) {
+            vectors[i] = {values[2 * i], values[(2 * i) + 1]};
+        }
+        return vectors;
+    }
+
+    inline auto uniformVectors(std::size_t count, float lo, float hi,
+                               std::uint64_t seed)
+        -> std::vector<sf::Vector2f> {
+        simlab::Random random(seed);
+        return uniformVectors(count, lo, hi, random);
+    }
+
+}  // namespace fixtures
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace simlab {
+
+    /**
+     * @brief Heap allocation counts per thread, per frame and per zone
+     * With SIMLAB_TRACK_ALLOCATIONS the library replaces global operator
+     * new/delete and counts every allocation against the calling thread;
+     * without it the hooks are absent and every count reads zero.
+     * Profiler zones pick the counts up automatically. At exit,
+     * SIMLAB_ALLOC_REPORT=1 prints per-thread and per-frame totals and
+     * SIMLAB_ALLOC_SITES=<warmup frames> prints the call sites that still
+     * allocate inside frames once that many frames have passed.
+     */
+    class AllocationTracker {
+      public:
+
+        struct Counts {
+            std::uint64_t allocations = 0;
+            std::uint64_t frees       = 0;
+            std::uint64_t bytes       = 0;  // Requested, not freed
+
+            auto operator-(const Counts& start) const -> Counts {
+                return {allocations - start.allocations, frees - start.frees,
+                        bytes - start.bytes};
+            }
+        };
+
+        // Threads beyond this share the last slot
+        static constexpr std::size_t MaxThreads = 64;
+        static constexpr std::size_t MaxSites   = 512;
+        static constexpr int         SiteDepth  = 4;
+
+        AllocationTracker()                                            = delete;
+        AllocationTracker(const AllocationTracker&)                    = delete;
+        AllocationTracker(AllocationTracker&&)                         = delete;
+        auto operator=(const AllocationTracker&) -> AllocationTracker& = delete;
+        auto operator=(AllocationTracker&&) -> AllocationTracker&      = delete;
+        ~AllocationTracker()                                           = delete;
+
+        // True when the allocation hooks are compiled in
+        static auto isEnabled() -> bool;
+
+        // Running totals of the calling thread
+        static auto thread() -> Counts;
+
+        // Running totals of every thread so far
+        static auto total() -> Counts;
+
+        /**
+         * @brief Bracket one frame of the calling thread
+         * Game::Run does this for the main loop; endFrame() returns what
+         * the thread allocated since beginFrame()
+         */
+        static void beginFrame();
+
+        static auto endFrame() -> Counts;
+
+        static auto getLastFrame() -> Counts;
+
+        static auto getFrameCount() -> std::uint64_t;
+
+        /**
+         * @brief Record a short backtrace for every allocation, in or out
+         * of frames. Expensive; sites are kept until reportSites()
+         */
+        static void setSiteCapture(bool enable);
+
+        static auto isCapturingSites() -> bool;
+
+        // Per-thread and per-frame totals to stderr
+        static void report();
+
+        // Most frequent allocation sites to stderr
+        static void reportSites(std::size_t limit = 20);
+
+        // Frame bracketing for a scope
+        class FrameScope {
+          public:
+
+            FrameScope() {
+                beginFrame();
+            }
+
+            FrameScope(const FrameScope&)                    = delete;
+            FrameScope(FrameScope&&)                         = delete;
+            auto operator=(const FrameScope&) -> FrameScope& = delete;
+            auto operator=(FrameScope&&) -> FrameScope&      = delete;
+
+            ~FrameScope() {
+                endFrame();
+            }
+        };
+    };
+
+}  // namespace simlab
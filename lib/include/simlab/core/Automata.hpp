@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace simlab {
+
+    /**
+     * @brief Life-like rule as birth/survival neighbour-count bitmasks
+     * Bit n of birth is set when a dead cell with n live neighbours is
+     * born, bit n of survive when a live cell with n neighbours stays alive
+     */
+    struct LifeRule {
+        std::uint16_t birth   = 0;
+        std::uint16_t survive = 0;
+        bool          wrap    = true;  // Torus; otherwise outside is dead
+
+        // B3/S23 on a torus
+        static constexpr auto conway() -> LifeRule {
+            return {1U << 3U, (1U << 2U) | (1U << 3U), true};
+        }
+
+        // B37/S1234 with dead borders
+        static constexpr auto maze() -> LifeRule {
+            return {(1U << 3U) | (1U << 7U),
+                    (1U << 1U) | (1U << 2U) | (1U << 3U) | (1U << 4U), false};
+        }
+
+        auto nextState(bool alive, int neighbours) const -> bool {
+            std::uint16_t mask = alive ? survive : birth;
+            return ((mask >> neighbours) & 1U) != 0;
+        }
+    };
+
+    // Step functions shared by the automata demos and benchmarks
+    class Automata {
+      public:
+
+        using Grid = std::vector<std::vector<bool>>;
+
+        Automata()                                   = delete;
+        Automata(const Automata&)                    = delete;
+        Automata(Automata&&)                         = delete;
+        auto operator=(const Automata&) -> Automata& = delete;
+        auto operator=(Automata&&) -> Automata&      = delete;
+        ~Automata()                                  = delete;
+
+        // size x size cells, each alive with probability density
+        static auto randomGrid(std::size_t size, float density,
+                               std::uint64_t seed) -> Grid;
+
+        // Live cells among the 8 neighbours of (row, col)
+        static auto countNeighbours(const Grid& grid, int row, int col,
+                                    bool wrap) -> int;
+
+        /**
+         * @brief One generation of a life-like automaton
+         * next is resized to match grid and may be reused between calls
+         */
+        static void lifeStep(const Grid& grid, Grid& next,
+                             const LifeRule& rule);
+
+        // Wolfram elementary rule: bit (left, mid, right) of rule
+        static auto elementaryNextState(std::uint8_t rule, bool left, bool mid,
+                                        bool right) -> bool {
+            unsigned pattern = (static_cast<unsigned>(left) << 2U) |
+                               (static_cast<unsigned>(mid) << 1U) |
+                               static_cast<unsigned>(right);
+            return ((rule >> pattern) & 1U) != 0;  // LSB = pattern 000
+        }
+
+        // One row of an elementary automaton with wrap-around edges
+        static void elementaryStep(std::uint8_t             rule,
+                                   const std::vector<bool>& states,
+                                   std::vector<bool>&       next);
+    };
+
+}  // namespace simlab
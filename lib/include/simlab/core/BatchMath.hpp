@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstddef>
+
+namespace simlab {
+
+    /**
+     * @brief Vector math over structure-of-arrays float data
+     * Each call works on n 2D vectors stored as separate x and y arrays,
+     * the batch counterparts of the utils:: helpers. The kernel set is
+     * picked once at first use from what the CPU supports (AVX2, SSE2 or
+     * plain scalar) and can be overridden with SIMLAB_BATCH_ISA=scalar|
+     * sse|avx2 or setIsa(). Every kernel set gives bit-identical results:
+     * no FMA contraction and no approximate reciprocals. Output arrays may
+     * alias their inputs exactly, not partially.
+     */
+    class BatchMath {
+      public:
+
+        enum class Isa { Scalar, SSE, AVX2 };
+
+        BatchMath()                                    = delete;
+        BatchMath(const BatchMath&)                    = delete;
+        BatchMath(BatchMath&&)                         = delete;
+        auto operator=(const BatchMath&) -> BatchMath& = delete;
+        auto operator=(BatchMath&&) -> BatchMath&      = delete;
+        ~BatchMath()                                   = delete;
+
+        // out[i] = |(x[i], y[i])|
+        static void length(const float* x, const float* y, float* out,
+                           std::size_t n);
+
+        // In place; zero vectors stay zero like utils::normalize
+        static void normalize(float* x, float* y, std::size_t n);
+
+        // out[i] = a[i] . b[i]
+        static void dot(const float* ax, const float* ay, const float* bx,
+                        const float* by, float* out, std::size_t n);
+
+        // y[i] += a * x[i], e.g. positions += dt * velocities per axis
+        static void axpy(float a, const float* x, float* y, std::size_t n);
+
+        // v[i] -= 2 (v[i] . n[i]) n[i]; normals must be unit length
+        static void reflect(float* vx, float* vy, const float* nx,
+                            const float* ny, std::size_t n);
+
+        // In place, every vector by the same angle
+        static void rotate(float* x, float* y, float degrees, std::size_t n);
+
+        // In place, into [minX, maxX] x [minY, maxY]
+        static void clampToRect(float* x, float* y, float minX, float minY,
+                                float maxX, float maxY, std::size_t n);
+
+        static auto getIsa() -> Isa;
+
+        // Throws std::runtime_error when the CPU lacks the instruction set
+        static void setIsa(Isa isa);
+
+        static auto isSupported(Isa isa) -> bool;
+
+        static auto getIsaName(Isa isa) -> const char*;
+    };
+
+}  // namespace simlab
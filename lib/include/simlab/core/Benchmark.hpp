@@ -8,9 +8,15 @@
 #include <fmt/format.h>
 #include <fmt/ranges.h>
 
-#include <algorithm>
+#include "simlab/core/Histogram.hpp"
+#include "simlab/core/PerfCounters.hpp"
+
+#include <array>
+#include <atomic>
 #include <chrono>
+#include <cstdint>
 #include <string>
+#include <utility>
 #include <vector>
 
 class Benchmark {
@@ -19,9 +25,12 @@ class Benchmark {
     using Clock    = std::chrono::high_resolution_clock;
     using Duration = std::chrono::duration<double, std::milli>;  // milliseconds
 
+    using Counters = simlab::PerfCounters;
+
     // RAII scope-based timer
     class Scope {
         Benchmark&        bm;
+        Counters::Sample  startCounters;
         Clock::time_point start;
 
       public:
@@ -31,31 +40,78 @@ class Benchmark {
         auto operator=(const Scope&) -> Scope& = delete;
         auto operator=(Scope&&) -> Scope&      = delete;
 
+        // Counters are read outside the timed span to keep syscalls out
         explicit Scope(Benchmark& benchmark)
-            : bm(benchmark), start(Clock::now()) {}
+            : bm(benchmark),
+              startCounters(bm.readCounters()),
+              start(Clock::now()) {}
 
         ~Scope() {
-            auto end = Clock::now();
-            bm.addTime(
-                std::chrono::duration<double, std::milli>(end - start).count());
+            bm.addTime(Clock::now() - start);
+            bm.addCounters(startCounters);
         }
     };
 
-    explicit Benchmark(std::string name = "") : name(std::move(name)) {}
+    // Summary of one Benchmark, all times in milliseconds
+    struct Result {
+        std::string   name;
+        std::uint64_t runs     = 0;
+        double        meanMs   = 0.0;
+        double        stddevMs = 0.0;
+        double        minMs    = 0.0;
+        double        p50Ms    = 0.0;
+        double        p90Ms    = 0.0;
+        double        p99Ms    = 0.0;
+        double        p999Ms   = 0.0;
+        double        maxMs    = 0.0;
+        double        totalMs  = 0.0;
+        std::uint64_t frames   = 0;
+        double        avgFps   = 0.0;
+        double        lowFps   = 0.0;  // 1% low
+
+        // Hardware counters per call; 0 when not collected
+        double ipc                 = 0.0;
+        double cyclesPerCall       = 0.0;
+        double instructionsPerCall = 0.0;
+        double l1dMissesPerCall    = 0.0;
+        double llcMissesPerCall    = 0.0;
+        double branchMissesPerCall = 0.0;
+    };
+
+    explicit Benchmark(std::string name = "")
+        : name(std::move(name)), countersEnabled(countersFromEnvironment()) {
+        registerInstance(this);
+    }
+
+    Benchmark(const Benchmark&)                    = delete;
+    Benchmark(Benchmark&&)                         = delete;
+    auto operator=(const Benchmark&) -> Benchmark& = delete;
+    auto operator=(Benchmark&&) -> Benchmark&      = delete;
 
     ~Benchmark() {
         report();
+        unregisterInstance(this);
     }
 
-    // Start/Stop for manual timing
+    /**
+     * @brief Also collect per-thread hardware counters for every call
+     * Off by default, or on for all instances with SIMLAB_PERF_COUNTERS=1.
+     * Costs a few syscalls per call; counters the kernel refuses are
+     * skipped and report() says so.
+     */
+    void enableCounters(bool enable = true) {
+        countersEnabled = enable;
+    }
+
+    // Start/Stop for manual timing (single thread; use Scope elsewhere)
     void start() {
-        startTime = Clock::now();
+        startCounters = readCounters();
+        startTime     = Clock::now();
     }
 
     void stop() {
-        auto end = Clock::now();
-        addTime(
-            std::chrono::duration<double, std::milli>(end - startTime).count());
+        addTime(Clock::now() - startTime);
+        addCounters(startCounters);
     }
 
     // Benchmark ANY callable: method, function, lambda, functor
@@ -66,18 +122,19 @@ class Benchmark {
         using ResultT = decltype(std::__invoke(std::forward<Callable>(callable),
                                                std::forward<Args>(args)...));
 
-        auto t0 = Clock::now();
+        auto counters = readCounters();
+        auto t0       = Clock::now();
 
         if constexpr (std::is_void_v<ResultT>) {
             std::__invoke(std::forward<Callable>(callable),
                           std::forward<Args>(args)...);
-            auto t1 = Clock::now();
-            addTime(std::chrono::duration<double, std::milli>(t1 - t0).count());
+            addTime(Clock::now() - t0);
+            addCounters(counters);
         } else {
             auto&& result = std::__invoke(std::forward<Callable>(callable),
                                           std::forward<Args>(args)...);
-            auto   t1     = Clock::now();
-            addTime(std::chrono::duration<double, std::milli>(t1 - t0).count());
+            addTime(Clock::now() - t0);
+            addCounters(counters);
             return result;
         }
     }
@@ -87,71 +144,193 @@ class Benchmark {
         auto headerColor = fmt::color::dark_slate_gray;
         fmt::print(fg(headerColor) | fmt::emphasis::italic,
                    "\n========== Benchmark: '{}' ==========\n", name);
-        if (!times.empty()) {
-            double sum = 0.0;
-            double min = 0.0;
-            double max = 0.0;
-            for (auto time : times) {
-                sum += time;
-                min = std::min(time, min);
-                max = std::max(time, max);
-            }
-            double avg = sum / times.size();
-
+        if (times.count() != 0) {
             auto color = fmt::color::light_sea_green;
-            fmt::print(fg(color), "  Runs       : {}\n", times.size());
-            fmt::print(fg(color), "  Avg Time   : {:.3f} ms\n", avg);
-            fmt::print(fg(color), "  Min Time   : {:.3f} ms\n", min);
-            fmt::print(fg(color), "  Max Time   : {:.3f} ms\n", max);
-            fmt::print(fg(color), "  Total Time : {:.3f} ms\n\n", sum);
+            fmt::print(fg(color), "  Runs       : {}\n", times.count());
+            fmt::print(fg(color), "  Avg Time   : {:.3f} ms\n",
+                       toMs(times.mean()));
+            fmt::print(fg(color), "  Std Dev    : {:.3f} ms\n",
+                       toMs(times.stddev()));
+            fmt::print(fg(color), "  Min Time   : {:.3f} ms\n",
+                       toMs(times.min()));
+            fmt::print(fg(color), "  p50 Time   : {:.3f} ms\n",
+                       toMs(times.percentile(0.50)));
+            fmt::print(fg(color), "  p90 Time   : {:.3f} ms\n",
+                       toMs(times.percentile(0.90)));
+            fmt::print(fg(color), "  p99 Time   : {:.3f} ms\n",
+                       toMs(times.percentile(0.99)));
+            fmt::print(fg(color), "  p99.9 Time : {:.3f} ms\n",
+                       toMs(times.percentile(0.999)));
+            fmt::print(fg(color), "  Max Time   : {:.3f} ms\n",
+                       toMs(times.max()));
+            fmt::print(fg(color), "  Total Time : {:.3f} ms\n\n",
+                       toMs(times.sum()));
         }
 
-        if (!fpsPerFrame.empty()) {
-            double sumFPS = 0.0;
-            double minFPS = fpsPerFrame[0];
-            double maxFPS = fpsPerFrame[0];
-            for (double fps : fpsPerFrame) {
-                sumFPS += fps;
-                minFPS = std::min(fps, minFPS);
-                maxFPS = std::max(fps, maxFPS);
-            }
-            double avgFPS = sumFPS / fpsPerFrame.size();
-
+        // FPS from the interval between consecutive executions
+        if (frameIntervals.count() != 0) {
             auto color = fmt::color::purple;
-            fmt::print(fg(color), "  Avg FPS    : {:.2f}\n", avgFPS);
-            fmt::print(fg(color), "  Min FPS    : {:.2f}\n", minFPS);
-            fmt::print(fg(color), "  Max FPS    : {:.2f}\n", maxFPS);
+            fmt::print(fg(color), "  Avg FPS    : {:.2f}\n",
+                       toFps(frameIntervals.mean()));
+            fmt::print(fg(color), "  1% Low FPS : {:.2f}\n",
+                       toFps(frameIntervals.percentile(0.99)));
+            fmt::print(fg(color), "  Min FPS    : {:.2f}\n",
+                       toFps(frameIntervals.max()));
+            fmt::print(fg(color), "  Max FPS    : {:.2f}\n",
+                       toFps(frameIntervals.min()));
+        }
+
+        if (countersEnabled) {
+            reportCounters();
         }
         fmt::print(fg(headerColor) | fmt::emphasis::italic,
                    "====================================\n\n");
     }
 
+    auto snapshot() const -> Result {
+        Result result;
+        result.name     = name;
+        result.runs     = times.count();
+        result.meanMs   = toMs(times.mean());
+        result.stddevMs = toMs(times.stddev());
+        result.minMs    = toMs(times.min());
+        result.p50Ms    = toMs(times.percentile(0.50));
+        result.p90Ms    = toMs(times.percentile(0.90));
+        result.p99Ms    = toMs(times.percentile(0.99));
+        result.p999Ms   = toMs(times.percentile(0.999));
+        result.maxMs    = toMs(times.max());
+        result.totalMs  = toMs(times.sum());
+        result.frames   = frameIntervals.count();
+        result.avgFps   = toFps(frameIntervals.mean());
+        result.lowFps   = toFps(frameIntervals.percentile(0.99));
+
+        result.ipc                 = counterRatio(Counters::Instructions,
+                                                  Counters::Cycles);
+        result.cyclesPerCall       = counterPerCall(Counters::Cycles);
+        result.instructionsPerCall = counterPerCall(Counters::Instructions);
+        result.l1dMissesPerCall    = counterPerCall(Counters::L1DMisses);
+        result.llcMissesPerCall    = counterPerCall(Counters::LLCMisses);
+        result.branchMissesPerCall = counterPerCall(Counters::BranchMisses);
+        return result;
+    }
+
+    // ========== EXPORT ==========
+
+    /**
+     * @brief Results of every Benchmark in the process
+     * Live instances are snapshotted; destroyed ones keep their final result
+     */
+    static auto collectResults() -> std::vector<Result>;
+
+    // Build and host metadata as key/value pairs
+    static auto metadata() -> std::vector<std::pair<std::string, std::string>>;
+
+    static void exportJson(const std::string& path);
+
+    // "# key=value" metadata lines, then one header row and one row each
+    static void exportCsv(const std::string& path);
+
+    // Export by extension (.json, otherwise CSV)
+    static void exportResults(const std::string& path);
+
+    auto getName() const -> const std::string& {
+        return name;
+    }
+
+    // Measured durations in nanoseconds
+    auto getTimes() const -> const simlab::Histogram& {
+        return times;
+    }
+
+    // Nanoseconds between consecutive executions
+    auto getFrameIntervals() const -> const simlab::Histogram& {
+        return frameIntervals;
+    }
+
   protected:
 
-    // Add a recorded time
-    // Add a recorded time and compute FPS based on the previous frame
-    void addTime(double ms) {
-        times.push_back(ms);
+    // Record a duration and the interval since the previous execution.
+    // Safe to call from several threads at once.
+    void addTime(Clock::duration elapsed) {
+        times.record(toNanoseconds(elapsed));
 
-        // Compute FPS between last execution and this one
-        if (lastTimestamp.time_since_epoch().count() == 0) {
-            // First run, no previous frame
-            lastTimestamp = Clock::now();
-        } else {
-            auto   now = Clock::now();
-            double deltaMs =
-                std::chrono::duration<double, std::milli>(now - lastTimestamp)
-                    .count();
-            lastTimestamp = now;
-            fpsPerFrame.push_back(1000.0 / deltaMs);
+        auto now      = Clock::now().time_since_epoch().count();
+        auto previous = lastTimestamp.exchange(now, std::memory_order_relaxed);
+        if (previous != 0 && now > previous) {
+            frameIntervals.record(
+                toNanoseconds(Clock::duration(now - previous)));
+        }
+    }
+
+    auto readCounters() const -> Counters::Sample {
+        return countersEnabled ? Counters::read() : Counters::Sample{};
+    }
+
+    // Attribute the counters since start to this call
+    void addCounters(const Counters::Sample& start) {
+        if (!countersEnabled) {
+            return;
+        }
+        Counters::Sample delta = Counters::read() - start;
+        for (std::size_t i = 0; i < Counters::Count; i++) {
+            if (delta.isValid(static_cast<Counters::Counter>(i))) {
+                counterTotals[i].fetch_add(delta.values[i],
+                                           std::memory_order_relaxed);
+                counterCalls[i].fetch_add(1, std::memory_order_relaxed);
+            }
         }
     }
 
   private:
 
-    std::string         name;
-    Clock::time_point   startTime;
-    Clock::time_point   lastTimestamp;  // stores timestamp of last execution
-    std::vector<double> times;          // measured durations in ms
-    std::vector<double> fpsPerFrame;    // FPS between consecutive executions
+    static auto countersFromEnvironment() -> bool;
+
+    void reportCounters() const;
+
+    auto counterPerCall(Counters::Counter counter) const -> double {
+        auto calls = counterCalls[counter].load(std::memory_order_relaxed);
+        return calls == 0 ? 0.0
+                          : static_cast<double>(counterTotals[counter].load(
+                                std::memory_order_relaxed)) /
+                                static_cast<double>(calls);
+    }
+
+    auto counterRatio(Counters::Counter numerator,
+                      Counters::Counter denominator) const -> double {
+        double den = counterPerCall(denominator);
+        return den == 0.0 ? 0.0 : counterPerCall(numerator) / den;
+    }
+
+    // Registry backing collectResults(); see Benchmark.cpp.
+    // Set SIMLAB_BENCHMARK_EXPORT=<path> to export at process exit.
+    static void registerInstance(Benchmark* benchmark);
+    static void unregisterInstance(Benchmark* benchmark);
+
+    static auto toNanoseconds(Clock::duration elapsed) -> std::uint64_t {
+        auto ns =
+            std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed)
+                .count();
+        return ns < 0 ? 0 : static_cast<std::uint64_t>(ns);
+    }
+
+    template <typename T>
+    static auto toMs(T ns) -> double {
+        return static_cast<double>(ns) / 1e6;
+    }
+
+    template <typename T>
+    static auto toFps(T ns) -> double {
+        return ns == 0 ? 0.0 : 1e9 / static_cast<double>(ns);
+    }
+
+    std::string             name;
+    bool                    countersEnabled = false;
+    Counters::Sample        startCounters;
+    Clock::time_point       startTime;
+    std::atomic<Clock::rep> lastTimestamp{0};  // tick of last execution
+    simlab::Histogram       times;             // measured durations in ns
+    simlab::Histogram       frameIntervals;    // ns between executions
+
+    std::array<std::atomic<std::uint64_t>, Counters::Count> counterTotals{};
+    std::array<std::atomic<std::uint64_t>, Counters::Count> counterCalls{};
 };
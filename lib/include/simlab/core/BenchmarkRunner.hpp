@@ -0,0 +1,114 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace simlab {
+
+    class Game;
+
+    /**
+     * @brief Repeatable timing of simulation steps outside the game loop
+     * Setup (window and context creation included) is never timed. Each
+     * run warms up, then times repetitions of a fixed number of steps; a
+     * repetition's per-step time is one sample. Samples whose modified
+     * z-score (median/MAD) exceeds the threshold are rejected as OS noise,
+     * and the rest give a Student t confidence interval.
+     */
+    class BenchmarkRunner {
+      public:
+
+        struct Config {
+            std::size_t   warmupSteps        = 100;
+            std::size_t   repetitions        = 15;
+            std::size_t   stepsPerRepetition = 200;
+            float         dt                 = 1.0F / 120.0F;
+            std::uint64_t seed               = 42;
+            double        outlierThreshold   = 3.5;  // Modified z-score
+            double        confidence         = 0.95;
+        };
+
+        struct Interval {
+            double mean  = 0.0;
+            double lower = 0.0;
+            double upper = 0.0;
+        };
+
+        struct Result {
+            std::string name;
+            std::size_t size     = 0;  // Sweep parameter, 0 when unused
+            std::size_t runs     = 0;  // Repetitions kept
+            std::size_t rejected = 0;  // Repetitions dropped as outliers
+            double      stddevMs = 0.0;
+            double      maxMs    = 0.0;
+            Interval    stepMs;          // Time per step
+            Interval    stepsPerSecond;  // Bounds map from stepMs
+        };
+
+        // One simulation step of length dt
+        using StepFunction = std::function<void(float dt)>;
+
+        // Builds the state for a given size and seed, returns its step
+        using Setup =
+            std::function<StepFunction(std::size_t size, std::uint64_t seed)>;
+
+        using GameFactory = std::function<std::unique_ptr<Game>(
+            std::size_t size, std::uint64_t seed)>;
+
+        BenchmarkRunner();
+
+        explicit BenchmarkRunner(Config config);
+
+        auto run(const std::string& name, const StepFunction& step)
+            -> Result;
+
+        auto run(const std::string& name, const Setup& setup,
+                 std::size_t size) -> Result;
+
+        // Steps a Game through Game::simulate(), without events or drawing
+        auto runGame(const std::string& name, const GameFactory& factory,
+                     std::size_t size = 0) -> Result;
+
+        // One run per size, named "<name>/<size>"
+        auto sweep(const std::string& name, const Setup& setup,
+                   const std::vector<std::size_t>& sizes)
+            -> std::vector<Result>;
+
+        auto sweepGame(const std::string& name, const GameFactory& factory,
+                       const std::vector<std::size_t>& sizes)
+            -> std::vector<Result>;
+
+        auto getConfig() const -> const Config& {
+            return m_config;
+        }
+
+        static void report(const Result& result);
+
+        /**
+         * @brief Per-size table with the local scaling exponent
+         * The exponent is the log-log slope between neighbouring sizes:
+         * 1 means linear, 2 quadratic
+         */
+        static void reportScaling(const std::vector<Result>& results);
+
+        /**
+         * @brief CSV with the same metadata header and name/runs/mean_ms/
+         * stddev_ms/p99_ms columns as Benchmark::exportCsv, so bench_compare
+         * accepts it; p99_ms holds the slowest kept repetition
+         */
+        static void exportCsv(const std::string&         path,
+                              const std::vector<Result>& results);
+
+      private:
+
+        auto measure(const std::string& name, const StepFunction& step,
+                     std::size_t size) const -> Result;
+
+        Config m_config;
+    };
+
+}  // namespace simlab
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace simlab::benchmark {
+
+    /**
+     * @brief Regularized incomplete beta function I_x(a, b)
+     * Lentz's continued fraction, switched to the symmetric form where it
+     * converges faster
+     */
+    auto incompleteBeta(double a, double b, double x) -> double;
+
+    // P(T <= t) for Student's t with df degrees of freedom
+    auto studentCdf(double t, double df) -> double;
+
+    // Two-sided critical value: P(|T| <= q) == confidence
+    auto studentQuantile(double confidence, double df) -> double;
+
+    // Quote a CSV field when it holds a separator, quote or newline
+    auto escapeCsv(const std::string& text) -> std::string;
+
+    // Split one CSV row, undoing escapeCsv
+    auto splitCsv(const std::string& line) -> std::vector<std::string>;
+
+}  // namespace simlab::benchmark
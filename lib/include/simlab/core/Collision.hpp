@@ -1,10 +1,16 @@
+#pragma once
 
 #include <SFML/Graphics.hpp>
 
+#include "simlab/core/PolygonCollider.hpp"
+#include "simlab/core/SfmlInterop.hpp"
+#include "simlab/core/SignedDistanceField.hpp"
 #include "simlab/core/utils.hpp"
 
 #include <algorithm>
+#include <array>
 #include <cmath>
+#include <limits>
 #include <vector>
 
 namespace simlab {
@@ -71,8 +77,8 @@ namespace simlab {
             }
 
             // Get masses (assuming uniform density, mass = area)
-            float mass1 = std::pow(circle1.getRadius(), 2.0F);
-            float mass2 = std::pow(circle2.getRadius(), 2.0F);
+            float mass1 = circle1.getRadius() * circle1.getRadius();
+            float mass2 = circle2.getRadius() * circle2.getRadius();
 
             // Position correction with improved stability
             sf::Vector2f pos1 = circle1.getPosition();
@@ -142,6 +148,13 @@ namespace simlab {
         static auto windowCollision(const sf::CircleShape&  circle,
                                     const sf::RenderWindow& window)
             -> CollisionInfo {
+            return windowCollision(circle, sf::Vector2f(window.getSize()));
+        }
+
+        // Query the window size once per step and pass it in here
+        static auto windowCollision(const sf::CircleShape& circle,
+                                    const sf::Vector2f&    windowSize)
+            -> CollisionInfo {
             CollisionInfo result;
             float         radius = circle.getRadius();
             sf::Vector2f  pos    = circle.getPosition();
@@ -149,8 +162,8 @@ namespace simlab {
             float         right  = pos.x + radius;
             float         top    = pos.y - radius;
             float         bottom = pos.y + radius;
-            float         winW   = static_cast<float>(window.getSize().x);
-            float         winH   = static_cast<float>(window.getSize().y);
+            float         winW   = windowSize.x;
+            float         winH   = windowSize.y;
 
             sf::Vector2f normal(0.F, 0.F);
             float        penetration = 0.F;
@@ -185,12 +198,184 @@ namespace simlab {
             return result;
         }
 
+        /**
+         * @brief Circle against the static world's distance field
+         * O(1) per circle: one bilinear sample plus its gradient. The normal
+         * points away from the obstacle, like windowCollision.
+         */
+        static auto sdfCollision(const sf::CircleShape&     circle,
+                                 const SignedDistanceField& field)
+            -> CollisionInfo {
+            CollisionInfo result;
+            float         radius = circle.getRadius();
+            sf::Vector2f  center =
+                circle.getTransform().transformPoint(radius, radius);
+
+            float distance = field.sample(fromSf(center));
+            if (distance >= radius) {
+                return result;
+            }
+
+            result.collided     = true;
+            result.normal       = toSf(field.gradient(fromSf(center)));
+            result.penetration  = radius - distance;
+            result.magnitude    = result.penetration;
+            result.point        = center - (result.normal * distance);
+            result.contactPoint = result.point;
+            return result;
+        }
+
         // General collision check
         static auto shapeCollision(const sf::Shape& s1, const sf::Shape& s2)
             -> CollisionInfo {
-            auto poly1 = utils::getGlobalPoints(s1);
-            auto poly2 = utils::getGlobalPoints(s2);
-            return polygonsIntersect(poly1, poly2);
+            if (s1.getPointCount() > PolygonCollider::MaxVertices ||
+                s2.getPointCount() > PolygonCollider::MaxVertices) {
+                auto poly1 = utils::getGlobalPoints(s1);
+                auto poly2 = utils::getGlobalPoints(s2);
+                return polygonsIntersect(poly1, poly2);
+            }
+
+            // Stack-only path; keep PolygonColliders around to reuse geometry
+            PolygonCollider poly1(s1);
+            PolygonCollider poly2(s2);
+            return shapeCollision(poly1, poly2);
+        }
+
+        /**
+         * @brief Convex collision on cached colliders
+         * SAT costs O(n * m) projections while GJK/EPA only needs O(n + m)
+         * per support query, so many-sided pairs such as circle polygons go
+         * through GJK
+         */
+        static auto shapeCollision(const PolygonCollider& poly1,
+                                   const PolygonCollider& poly2)
+            -> CollisionInfo {
+            if (poly1.getVertexCount() + poly2.getVertexCount() >
+                GjkVertexThreshold) {
+                return gjkCollision(poly1, poly2);
+            }
+            return satCollision(poly1, poly2);
+        }
+
+        // SAT over the cached outward normals of both polygons
+        static auto satCollision(const PolygonCollider& poly1,
+                                 const PolygonCollider& poly2)
+            -> CollisionInfo {
+            float        maxSeparation = -std::numeric_limits<float>::max();
+            sf::Vector2f bestNormal;
+
+            // Separation of polyB along every face normal of polyA; flip
+            // orients the result from poly1 towards poly2
+            auto checkFaces = [&](const PolygonCollider& polyA,
+                                  const PolygonCollider& polyB,
+                                  float                  flip) -> bool {
+                const sf::Vector2f* vertsA   = polyA.getVertices();
+                const sf::Vector2f* normalsA = polyA.getNormals();
+                const sf::Vector2f* vertsB   = polyB.getVertices();
+
+                for (size_t i = 0; i < polyA.getVertexCount(); i++) {
+                    const sf::Vector2f& axis = normalsA[i];
+                    if (axis.x == 0.F && axis.y == 0.F) {
+                        continue;
+                    }
+
+                    // Deepest point of B behind this face of A
+                    float faceProj   = utils::dotProduct(vertsA[i], axis);
+                    float separation = std::numeric_limits<float>::max();
+                    for (size_t j = 0; j < polyB.getVertexCount(); j++) {
+                        separation = std::min(
+                            separation,
+                            utils::dotProduct(vertsB[j], axis) - faceProj);
+                    }
+
+                    if (separation > 0.F) {
+                        return false;  // Gap found
+                    }
+                    if (separation > maxSeparation) {
+                        maxSeparation = separation;
+                        bestNormal    = axis * flip;
+                    }
+                }
+                return true;
+            };
+
+            if (!checkFaces(poly1, poly2, 1.F) ||
+                !checkFaces(poly2, poly1, -1.F)) {
+                return {};  // no collision
+            }
+
+            CollisionInfo result;
+            result.collided     = true;
+            result.penetration  = -maxSeparation;
+            result.magnitude    = result.penetration;
+            result.normal       = bestNormal;
+            result.point        = poly1.getCentroid();
+            result.contactPoint = poly1.support(bestNormal);
+            return result;
+        }
+
+        /**
+         * @brief GJK intersection test with EPA penetration depth
+         * Normal points from poly1 towards poly2
+         */
+        static auto gjkCollision(const PolygonCollider& poly1,
+                                 const PolygonCollider& poly2)
+            -> CollisionInfo {
+            // Support of the Minkowski difference poly1 - poly2
+            auto support = [&](const sf::Vector2f& dir) -> sf::Vector2f {
+                return poly1.support(dir) - poly2.support(-dir);
+            };
+
+            std::array<sf::Vector2f, 3> simplex;
+            std::size_t                 count = 0;
+
+            sf::Vector2f direction = poly2.getCentroid() - poly1.getCentroid();
+            if (utils::magnitudeSquared(direction) < Epsilon) {
+                direction = {1.F, 0.F};
+            }
+
+            simplex[count++] = support(direction);
+            direction        = -simplex[0];
+
+            bool intersecting = false;
+            for (int iter = 0; iter < MaxGjkIterations; iter++) {
+                if (utils::magnitudeSquared(direction) < Epsilon) {
+                    intersecting = true;  // Origin lies on the simplex
+                    break;
+                }
+
+                sf::Vector2f point = support(direction);
+                if (utils::dotProduct(point, direction) <= 0.F) {
+                    return {};  // no collision
+                }
+
+                simplex[count++] = point;
+                if (updateSimplex(simplex, count, direction)) {
+                    intersecting = true;
+                    break;
+                }
+            }
+
+            if (!intersecting) {
+                return {};
+            }
+
+            CollisionInfo result;
+            result.collided = true;
+            result.point    = poly1.getCentroid();
+
+            if (count < 3) {
+                // Touching contact; there is no area for EPA to expand
+                result.normal = utils::normalize(poly2.getCentroid() -
+                                                 poly1.getCentroid());
+            } else {
+                expandPolytope(simplex, support, result.normal,
+                               result.penetration);
+            }
+
+            result.magnitude    = result.penetration;
+            result.contactPoint = poly1.support(result.normal);
+            return result;
         }
 
         // Helper: check polygon overlap on all axes
@@ -263,6 +448,126 @@ namespace simlab {
 
       private:
 
+        // Combined vertex count above which shapeCollision prefers GJK
+        static constexpr std::size_t GjkVertexThreshold = 16;
+        static constexpr int         MaxGjkIterations   = 32;
+        static constexpr int         MaxEpaIterations   = 32;
+        static constexpr std::size_t MaxPolytopeSize    = 64;
+        static constexpr float       Epsilon            = 1e-6F;
+        static constexpr float       EpaTolerance       = 1e-3F;
+
+        // Perpendicular of edge pointing towards target
+        static auto perpendicularTowards(const sf::Vector2f& edge,
+                                         const sf::Vector2f& target)
+            -> sf::Vector2f {
+            sf::Vector2f perp = utils::normalVector(edge);
+            return utils::dotProduct(perp, target) < 0.F ? -perp : perp;
+        }
+
+        /**
+         * @brief Reduce the simplex to the feature closest to the origin
+         * The newest point is simplex[count - 1]. Returns true when the
+         * triangle encloses the origin.
+         */
+        static auto updateSimplex(std::array<sf::Vector2f, 3>& simplex,
+                                  std::size_t& count, sf::Vector2f& direction)
+            -> bool {
+            if (count == 2) {
+                sf::Vector2f a  = simplex[1];
+                sf::Vector2f ab = simplex[0] - a;
+                sf::Vector2f ao = -a;
+
+                if (utils::dotProduct(ab, ao) > 0.F) {
+                    direction = perpendicularTowards(ab, ao);
+                    // Origin on the segment: touching
+                    return utils::magnitudeSquared(direction) < Epsilon ||
+                           std::abs(utils::crossProduct(ab, ao)) < Epsilon;
+                }
+                simplex[0] = a;
+                count      = 1;
+                direction  = ao;
+                return false;
+            }
+
+            sf::Vector2f a  = simplex[2];
+            sf::Vector2f b  = simplex[1];
+            sf::Vector2f c  = simplex[0];
+            sf::Vector2f ab = b - a;
+            sf::Vector2f ac = c - a;
+            sf::Vector2f ao = -a;
+
+            sf::Vector2f abPerp = -perpendicularTowards(ab, ac);
+            if (utils::dotProduct(abPerp, ao) > 0.F) {
+                simplex[0] = b;  // Drop c
+                simplex[1] = a;
+                count      = 2;
+                direction  = abPerp;
+                return false;
+            }
+
+            sf::Vector2f acPerp = -perpendicularTowards(ac, ab);
+            if (utils::dotProduct(acPerp, ao) > 0.F) {
+                simplex[1] = a;  // Drop b
+                count      = 2;
+                direction  = acPerp;
+                return false;
+            }
+            return true;
+        }
+
+        // EPA: grow the GJK triangle towards the closest Minkowski edge
+        template <typename Support>
+        static void expandPolytope(const std::array<sf::Vector2f, 3>& simplex,
+                                   const Support& support, sf::Vector2f& normal,
+                                   float& depth) {
+            std::array<sf::Vector2f, MaxPolytopeSize> polytope;
+            std::size_t                               size = 3;
+            std::copy(simplex.begin(), simplex.end(), polytope.begin());
+
+            // Outward edge normal is (e.y, -e.x) for counter-clockwise order
+            float winding =
+                utils::crossProduct(polytope[1] - polytope[0],
+                                    polytope[2] - polytope[0]) >= 0.F
+                    ? 1.F
+                    : -1.F;
+
+            for (int iter = 0; iter < MaxEpaIterations; iter++) {
+                std::size_t  closest     = 0;
+                float        minDistance = std::numeric_limits<float>::max();
+                sf::Vector2f minNormal;
+
+                for (std::size_t i = 0; i < size; i++) {
+                    sf::Vector2f edge = polytope[(i + 1) % size] - polytope[i];
+                    sf::Vector2f edgeNormal =
+                        utils::normalize(sf::Vector2f(edge.y, -edge.x)) *
+                        winding;
+                    float distance = utils::dotProduct(edgeNormal, polytope[i]);
+                    if (distance < minDistance) {
+                        minDistance = distance;
+                        minNormal   = edgeNormal;
+                        closest     = i;
+                    }
+                }
+
+                normal = minNormal;
+                depth  = minDistance;
+
+                sf::Vector2f point = support(minNormal);
+                if (utils::dotProduct(point, minNormal) - minDistance <
+                        EpaTolerance ||
+                    size == MaxPolytopeSize) {
+                    return;
+                }
+
+                // Insert the new support point after the closest edge start
+                std::copy_backward(polytope.begin() + closest + 1,
+                                   polytope.begin() + size,
+                                   polytope.begin() + size + 1);
+                polytope[closest + 1] = point;
+                size++;
+            }
+        }
+
         // Helper: project a polygon onto an axis
         static void projectPolygon(const std::vector<sf::Vector2f>& points,
                                    const sf::Vector2f& axis, float& min,
@@ -0,0 +1,102 @@
+#pragma once
+
+#include "simlab/core/ThreadPool.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace simlab {
+
+    // Two bodies (indices into the caller's body arrays) in contact
+    struct ContactPair {
+        std::uint32_t bodyA;
+        std::uint32_t bodyB;
+    };
+
+    /**
+     * @brief Colors the contact graph so contacts sharing no body can be
+     * solved concurrently
+     * Every color batch touches each body at most once, so a kernel that only
+     * writes the two bodies of its contact needs no locks. Contacts that do
+     * not fit in MaxColors are kept in a final batch that is solved serially.
+     */
+    class ContactGraph {
+      public:
+
+        static constexpr std::size_t MaxColors = 64;
+
+        /**
+         * @brief Greedy-color pairs for bodies indexed in [0, bodyCount)
+         * Storage is reused between calls, so steady-state rebuilds do not
+         * allocate
+         */
+        void build(const std::vector<ContactPair>& pairs,
+                   std::size_t                     bodyCount);
+
+        // Number of conflict-free batches (excludes the serial overflow)
+        auto getColorCount() const -> std::size_t {
+            return m_colorCount;
+        }
+
+        auto getContactCount() const -> std::size_t {
+            return m_pairs.size();
+        }
+
+        // Contacts sorted by color; batch c is [offset(c), offset(c + 1))
+        auto getContacts() const -> const std::vector<ContactPair>& {
+            return m_pairs;
+        }
+
+        auto getBatchOffset(std::size_t color) const -> std::size_t {
+            return m_batchOffsets[color];
+        }
+
+        /**
+         * @brief Run kernel(const ContactPair&) over every contact, one color
+         * batch at a time, fanning each batch out over the pool
+         */
+        template <typename Kernel>
+        void solve(ThreadPool& pool, Kernel&& kernel,
+                   std::size_t minChunk = 32) const {
+            for (std::size_t color = 0; color < m_colorCount; color++) {
+                const ContactPair* batch =
+                    m_pairs.data() + m_batchOffsets[color];
+                std::size_t count =
+                    m_batchOffsets[color + 1] - m_batchOffsets[color];
+
+                pool.parallelFor(
+                    count,
+                    [batch, &kernel](std::size_t begin, std::size_t end)
+                        -> void {
+                        for (std::size_t i = begin; i < end; i++) {
+                            kernel(batch[i]);
+                        }
+                    },
+                    minChunk);
+            }
+
+            // Overflow contacts conflict with every color; run them serially
+            for (std::size_t i = m_batchOffsets[m_colorCount];
+                 i < m_pairs.size(); i++) {
+                kernel(m_pairs[i]);
+            }
+        }
+
+        // Same traversal order as solve() on the calling thread only
+        template <typename Kernel>
+        void solveSerial(Kernel&& kernel) const {
+            for (const auto& pair : m_pairs) {
+                kernel(pair);
+            }
+        }
+
+      private:
+
+        std::vector<ContactPair>   m_pairs;
+        std::vector<std::uint8_t>  m_pairColors;
+        std::vector<std::uint64_t> m_bodyColorMasks;
+        std::vector<std::size_t>   m_batchOffsets;
+        std::size_t                m_colorCount = 0;
+    };
+
+}  // namespace simlab
@@ -0,0 +1,180 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__SSE__)
+#include <xmmintrin.h>
+#endif
+
+/**
+ * Approximate float math for simulation and drawing kernels.
+ *
+ * simlab::fastmath always approximates; call it directly where the error
+ * is known to be harmless. simlab::math forwards to fastmath when the
+ * library is built with SIMLAB_FAST_MATH (CMake option, OFF by default)
+ * and to <cmath> otherwise, so call sites using it switch together.
+ *
+ * Maximum errors over the stated domains, measured by bench_fastmath:
+ *   rsqrt, sqrt   relative 3e-7 with SSE, 5e-6 otherwise
+ *   sin, cos      absolute 8e-8 for |x| <= 1e4
+ *   atan2         absolute 2e-6 rad
+ *   acos          absolute 7e-5 rad on [-1, 1]
+ */
+#ifndef SIMLAB_FAST_MATH
+#define SIMLAB_FAST_MATH 0
+#endif
+
+namespace simlab::fastmath {
+
+    inline constexpr float Pi     = 3.14159265358979F;
+    inline constexpr float HalfPi = 1.57079632679490F;
+
+    // x > 0; reciprocal square root estimate refined by a Newton step
+    inline auto rsqrt(float x) -> float {
+#if defined(__SSE__)
+        float y = _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(x)));
+        return y * (1.5F - (0.5F * x * y * y));
+#else
+        std::uint32_t bits = 0;
+        std::memcpy(&bits, &x, sizeof(bits));
+        bits    = 0x5f375a86U - (bits >> 1);
+        float y = 0.F;
+        std::memcpy(&y, &bits, sizeof(y));
+        y = y * (1.5F - (0.5F * x * y * y));
+        return y * (1.5F - (0.5F * x * y * y));
+#endif
+    }
+
+    // x >= 0
+    inline auto sqrt(float x) -> float {
+        return x > 0.F ? x * rsqrt(x) : 0.F;
+    }
+
+    /**
+     * @brief Both at once: quadrant reduction by pi/2 in three parts,
+     * then minimax polynomials on [-pi/4, pi/4] (Cephes sinf/cosf)
+     */
+    inline void sincos(float x, float& sinOut, float& cosOut) {
+        constexpr float TwoOverPi = 0.636619772367581F;
+        constexpr float PiO2Hi    = 1.5703125F;
+        constexpr float PiO2Mid   = 4.837512969970703125e-4F;
+        constexpr float PiO2Lo    = 7.54978995489188216e-8F;
+
+        // Round half away from zero; nearbyint is a libm call
+        float t = x * TwoOverPi;
+        auto  q = static_cast<std::int32_t>(t + (t < 0.F ? -0.5F : 0.5F));
+        auto  k = static_cast<float>(q);
+        float r = ((x - (k * PiO2Hi)) - (k * PiO2Mid)) - (k * PiO2Lo);
+        float z = r * r;
+
+        float s = (((-1.9515295891e-4F * z) + 8.3321608736e-3F) * z) -
+                  1.6666654611e-1F;
+        s       = (s * z * r) + r;
+        float c = (((2.443315711809948e-5F * z) - 1.388731625493765e-3F) *
+                   z) +
+                  4.166664568298827e-2F;
+        c       = (c * z * z) - (0.5F * z) + 1.F;
+
+        // Quadrant q rotates (c, s) by q quarter turns
+        float sinR = (q & 1) != 0 ? c : s;
+        float cosR = (q & 1) != 0 ? s : c;
+        sinOut     = (q & 2) != 0 ? -sinR : sinR;
+        cosOut     = ((q + 1) & 2) != 0 ? -cosR : cosR;
+    }
+
+    inline auto sin(float x) -> float {
+        float s = 0.F;
+        float c = 0.F;
+        sincos(x, s, c);
+        return s;
+    }
+
+    inline auto cos(float x) -> float {
+        float s = 0.F;
+        float c = 0.F;
+        sincos(x, s, c);
+        return c;
+    }
+
+    // Odd minimax polynomial for atan on [0, 1], then octant fix-ups
+    inline auto atan2(float y, float x) -> float {
+        float ax = std::fabs(x);
+        float ay = std::fabs(y);
+        float hi = ax > ay ? ax : ay;
+        float lo = ax > ay ? ay : ax;
+        if (hi == 0.F) {
+            return 0.F;
+        }
+        float a = lo / hi;
+        float s = a * a;
+        float r =
+            a * (0.99997726F +
+                 (s * (-0.33262347F +
+                       (s * (0.19354346F +
+                             (s * (-0.11643287F +
+                                   (s * (0.05265332F +
+                                         (s * -0.01172120F))))))))));
+        r = ay > ax ? HalfPi - r : r;
+        r = x < 0.F ? Pi - r : r;
+        return y < 0.F ? -r : r;
+    }
+
+    // Abramowitz and Stegun 4.4.45, mirrored for negative x
+    inline auto acos(float x) -> float {
+        float ax = std::fabs(x);
+        ax       = ax < 1.F ? ax : 1.F;
+        float p  = (((((-0.0187293F * ax) + 0.0742610F) * ax) - 0.2121144F) *
+                    ax) +
+                  1.5707288F;
+        float r = p * sqrt(1.F - ax);
+        return x < 0.F ? Pi - r : r;
+    }
+}  // namespace simlab::fastmath
+
+namespace simlab::math {
+
+    inline constexpr bool FastMath = SIMLAB_FAST_MATH != 0;
+
+    inline auto rsqrt(float x) -> float {
+        if constexpr (FastMath) {
+            return fastmath::rsqrt(x);
+        } else {
+            return 1.F / std::sqrt(x);
+        }
+    }
+
+    inline auto sqrt(float x) -> float {
+        if constexpr (FastMath) {
+            return fastmath::sqrt(x);
+        } else {
+            return std::sqrt(x);
+        }
+    }
+
+    inline void sincos(float x, float& sinOut, float& cosOut) {
+        if constexpr (FastMath) {
+            fastmath::sincos(x, sinOut, cosOut);
+        } else {
+            sinOut = std::sin(x);
+            cosOut = std::cos(x);
+        }
+    }
+
+    inline auto atan2(float y, float x) -> float {
+        if constexpr (FastMath) {
+            return fastmath::atan2(y, x);
+        } else {
+            return std::atan2(y, x);
+        }
+    }
+
+    inline auto acos(float x) -> float {
+        if constexpr (FastMath) {
+            return fastmath::acos(x);
+        } else {
+            return std::acos(x);
+        }
+    }
+}  // namespace simlab::math
@@ -1,6 +1,7 @@
 #pragma once
 #include <SFML/Graphics.hpp>
 
+#include "simlab/core/PerformanceOverlay.hpp"
 #include "simlab/core/PhysicsManager.hpp"
 #include "simlab/logger/Logger.hpp"
 
@@ -37,6 +38,11 @@ namespace simlab {
 
         void Run();
 
+        // Advance the simulation one step without events or drawing
+        void simulate(float dt) {
+            Update(dt);
+        }
+
       protected:
 
         // --- to be overridden by subclasses ---
@@ -58,13 +64,15 @@ namespace simlab {
 
         std::unique_ptr<simlab::PhysicsManager> physicsManager;
 
-        sf::RenderWindow window;
-        Logger::Logger&  log;
+        sf::RenderWindow   window;
+        Logger::Logger&    log;
+        PerformanceOverlay overlay;  // Toggled with F3
 
       private:
 
         void pollEvents();
         void fixedUpdate(float dt);
+        void drawOverlay();
 
         uint  m_frameRate       = 120;
         float m_timeScale       = 1.0F;
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <SFML/Graphics/Vertex.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace simlab {
+
+    /**
+     * @brief Primitive shapes written straight into vertex buffers
+     * Shapes are emitted as sf::Triangles lists so any number of them,
+     * mixed, share one buffer and one draw call. Circles scale and move a
+     * cached unit circle, so emitting them needs no trigonometry; fetch
+     * the table once with unitCircle() and pass it to every call. The
+     * write* functions fill caller-sized memory and return one past the
+     * last vertex; the append* ones grow a vector first.
+     */
+    class Geometry {
+      public:
+
+        using UnitCircle = std::vector<sf::Vector2f>;
+
+        static constexpr std::size_t DefaultSegments      = 12;
+        static constexpr std::size_t TriangleVertexCount  = 3;
+        static constexpr std::size_t RectangleVertexCount = 6;
+
+        Geometry()                                   = delete;
+        Geometry(const Geometry&)                    = delete;
+        Geometry(Geometry&&)                         = delete;
+        auto operator=(const Geometry&) -> Geometry& = delete;
+        auto operator=(Geometry&&) -> Geometry&      = delete;
+        ~Geometry()                                  = delete;
+
+        /**
+         * @brief segments + 1 points on the unit circle, the last equal to
+         * the first. Built on first request and kept, so the reference
+         * stays valid; safe to call from any thread
+         */
+        static auto unitCircle(std::size_t segments = DefaultSegments)
+            -> const UnitCircle&;
+
+        static constexpr auto circleVertexCount(
+            std::size_t segments = DefaultSegments) -> std::size_t {
+            return segments * 3;
+        }
+
+        static auto writeCircle(sf::Vertex* out, const UnitCircle& unit,
+                                sf::Vector2f center, float radius,
+                                sf::Color color) -> sf::Vertex* {
+            sf::Vector2f previous = center + (radius * unit[0]);
+            for (std::size_t i = 1; i < unit.size(); i++) {
+                sf::Vector2f next = center + (radius * unit[i]);
+                *out++            = {center, color};
+                *out++            = {previous, color};
+                *out++            = {next, color};
+                previous          = next;
+            }
+            return out;
+        }
+
+        // Same corners and winding as utils::GenerateRectangle
+        static auto writeRectangle(sf::Vertex* out, sf::Vector2f center,
+                                   sf::Vector2f size, sf::Color color)
+            -> sf::Vertex* {
+            float        hw = size.x * 0.5F;
+            float        hh = size.y * 0.5F;
+            sf::Vector2f topLeft(center.x - hw, center.y - hh);
+            sf::Vector2f topRight(center.x + hw, center.y - hh);
+            sf::Vector2f bottomLeft(center.x - hw, center.y + hh);
+            sf::Vector2f bottomRight(center.x + hw, center.y + hh);
+
+            *out++ = {topLeft, color};
+            *out++ = {bottomLeft, color};
+            *out++ = {topRight, color};
+            *out++ = {topRight, color};
+            *out++ = {bottomLeft, color};
+            *out++ = {bottomRight, color};
+            return out;
+        }
+
+        // Apex up, base of 2 size, like utils::GenerateTriangle
+        static auto writeTriangle(sf::Vertex* out, sf::Vector2f center,
+                                  float size, sf::Color color)
+            -> sf::Vertex* {
+            *out++ = {{center.x, center.y - size}, color};
+            *out++ = {{center.x - size, center.y + size}, color};
+            *out++ = {{center.x + size, center.y + size}, color};
+            return out;
+        }
+
+        static void appendCircle(std::vector<sf::Vertex>& out,
+                                 const UnitCircle& unit, sf::Vector2f center,
+                                 float radius, sf::Color color) {
+            std::size_t start = out.size();
+            out.resize(start + circleVertexCount(unit.size() - 1));
+            writeCircle(out.data() + start, unit, center, radius, color);
+        }
+
+        static void appendRectangle(std::vector<sf::Vertex>& out,
+                                    sf::Vector2f center, sf::Vector2f size,
+                                    sf::Color color) {
+            std::size_t start = out.size();
+            out.resize(start + RectangleVertexCount);
+            writeRectangle(out.data() + start, center, size, color);
+        }
+
+        static void appendTriangle(std::vector<sf::Vertex>& out,
+                                   sf::Vector2f center, float size,
+                                   sf::Color color) {
+            std::size_t start = out.size();
+            out.resize(start + TriangleVertexCount);
+            writeTriangle(out.data() + start, center, size, color);
+        }
+    };
+
+}  // namespace simlab
@@ -0,0 +1,185 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+namespace simlab {
+
+    /**
+     * @brief Fixed-size log-linear (HDR-style) histogram of integer values
+     * Values below 128 are exact; above that every power of two is split into
+     * 64 linear sub-buckets, so relative error stays under ~0.8% up to 2^40
+     * (about 18 minutes in nanoseconds). record() is O(1), lock-free and safe
+     * to call from any number of threads; memory never grows.
+     */
+    class Histogram {
+      public:
+
+        static constexpr int           SubBucketBits  = 7;
+        static constexpr std::uint64_t SubBucketCount = 1U << SubBucketBits;
+        static constexpr std::uint64_t SubBucketHalf  = SubBucketCount / 2;
+        static constexpr int           MaxExponent    = 40;
+        static constexpr std::size_t   BucketCount =
+            SubBucketCount +
+            ((MaxExponent - SubBucketBits + 1) * SubBucketHalf);
+
+        Histogram() = default;
+
+        Histogram(const Histogram&)                    = delete;
+        Histogram(Histogram&&)                         = delete;
+        auto operator=(const Histogram&) -> Histogram& = delete;
+        auto operator=(Histogram&&) -> Histogram&      = delete;
+
+        void record(std::uint64_t value) {
+            m_buckets[bucketIndex(value)].fetch_add(1,
+                                                    std::memory_order_relaxed);
+            m_count.fetch_add(1, std::memory_order_relaxed);
+            m_sum.fetch_add(value, std::memory_order_relaxed);
+
+            std::uint64_t seen = m_min.load(std::memory_order_relaxed);
+            while (value < seen &&
+                   !m_min.compare_exchange_weak(seen, value,
+                                                std::memory_order_relaxed)) {
+            }
+            seen = m_max.load(std::memory_order_relaxed);
+            while (value > seen &&
+                   !m_max.compare_exchange_weak(seen, value,
+                                                std::memory_order_relaxed)) {
+            }
+        }
+
+        void reset() {
+            for (auto& bucket : m_buckets) {
+                bucket.store(0, std::memory_order_relaxed);
+            }
+            m_count.store(0, std::memory_order_relaxed);
+            m_sum.store(0, std::memory_order_relaxed);
+            m_min.store(std::numeric_limits<std::uint64_t>::max(),
+                        std::memory_order_relaxed);
+            m_max.store(0, std::memory_order_relaxed);
+        }
+
+        auto count() const -> std::uint64_t {
+            return m_count.load(std::memory_order_relaxed);
+        }
+
+        auto sum() const -> std::uint64_t {
+            return m_sum.load(std::memory_order_relaxed);
+        }
+
+        auto min() const -> std::uint64_t {
+            return count() == 0 ? 0 : m_min.load(std::memory_order_relaxed);
+        }
+
+        auto max() const -> std::uint64_t {
+            return m_max.load(std::memory_order_relaxed);
+        }
+
+        auto mean() const -> double {
+            auto samples = count();
+            return samples == 0 ? 0.0
+                                : static_cast<double>(sum()) /
+                                      static_cast<double>(samples);
+        }
+
+        // Standard deviation estimated from bucket midpoints
+        auto stddev() const -> double {
+            auto samples = count();
+            if (samples < 2) {
+                return 0.0;
+            }
+            double avg      = mean();
+            double variance = 0.0;
+            for (std::size_t i = 0; i < BucketCount; i++) {
+                auto hits = m_buckets[i].load(std::memory_order_relaxed);
+                if (hits != 0) {
+                    double diff = bucketMidpoint(i) - avg;
+                    variance += diff * diff * static_cast<double>(hits);
+                }
+            }
+            return std::sqrt(variance / static_cast<double>(samples - 1));
+        }
+
+        /**
+         * @brief Value at quantile q in [0, 1], e.g. 0.99 for p99
+         * Clamped to the recorded min/max so tails stay exact
+         */
+        auto percentile(double q) const -> std::uint64_t {
+            auto samples = count();
+            if (samples == 0) {
+                return 0;
+            }
+            double rank   = std::clamp(q, 0.0, 1.0) *
+                          static_cast<double>(samples);
+            auto   target = std::max<std::uint64_t>(
+                static_cast<std::uint64_t>(std::ceil(rank)), 1);
+
+            std::uint64_t seen = 0;
+            for (std::size_t i = 0; i < BucketCount; i++) {
+                seen += m_buckets[i].load(std::memory_order_relaxed);
+                if (seen >= target) {
+                    auto value = static_cast<std::uint64_t>(bucketMidpoint(i));
+                    return std::clamp(value, min(), max());
+                }
+            }
+            return max();
+        }
+
+        static constexpr auto bucketIndex(std::uint64_t value) -> std::size_t {
+            if (value < SubBucketCount) {
+                return static_cast<std::size_t>(value);
+            }
+            int exponent = 63 - __builtin_clzll(value);
+            if (exponent > MaxExponent) {
+                return BucketCount - 1;
+            }
+            // Top SubBucketBits bits of value, leading one included
+            std::uint64_t mantissa =
+                value >> (exponent - (SubBucketBits - 1));
+            return static_cast<std::size_t>(
+                SubBucketCount +
+                (static_cast<std::uint64_t>(exponent - SubBucketBits) *
+                 SubBucketHalf) +
+                (mantissa - SubBucketHalf));
+        }
+
+        static constexpr auto bucketLowerBound(std::size_t index)
+            -> std::uint64_t {
+            if (index < SubBucketCount) {
+                return index;
+            }
+            std::uint64_t offset   = index - SubBucketCount;
+            std::uint64_t exponent = (offset / SubBucketHalf) + SubBucketBits;
+            std::uint64_t mantissa = (offset % SubBucketHalf) + SubBucketHalf;
+            return mantissa << (exponent - (SubBucketBits - 1));
+        }
+
+        static constexpr auto bucketWidth(std::size_t index) -> std::uint64_t {
+            if (index < SubBucketCount) {
+                return 1;
+            }
+            std::uint64_t exponent =
+                ((index - SubBucketCount) / SubBucketHalf) + SubBucketBits;
+            return std::uint64_t{1} << (exponent - (SubBucketBits - 1));
+        }
+
+        static constexpr auto bucketMidpoint(std::size_t index) -> double {
+            return static_cast<double>(bucketLowerBound(index)) +
+                   (static_cast<double>(bucketWidth(index) - 1) / 2.0);
+        }
+
+      private:
+
+        std::array<std::atomic<std::uint64_t>, BucketCount> m_buckets{};
+        std::atomic<std::uint64_t>                          m_count{0};
+        std::atomic<std::uint64_t>                          m_sum{0};
+        std::atomic<std::uint64_t>                          m_max{0};
+        std::atomic<std::uint64_t>                          m_min{
+            std::numeric_limits<std::uint64_t>::max()};
+    };
+
+}  // namespace simlab
@@ -0,0 +1,121 @@
+#pragma once
+
+#include "simlab/core/Vec2.hpp"
+
+#include <array>
+#include <cmath>
+
+namespace simlab {
+
+    /**
+     * @brief Row-major 3x3 matrix for 2D affine transforms
+     * Elements are in the order sf::Transform's nine-float constructor
+     * takes them and points are column vectors, so a * b applies b first
+     * and composes like sf::Transform::combine. Default-constructs to the
+     * identity; everything but rotation(degrees) is constexpr.
+     */
+    struct alignas(16) Mat3 {
+        std::array<float, 9> m{1.F, 0.F, 0.F, 0.F, 1.F, 0.F, 0.F, 0.F, 1.F};
+
+        constexpr Mat3() = default;
+        constexpr Mat3(float a00, float a01, float a02, float a10, float a11,
+                       float a12, float a20, float a21, float a22)
+            : m{a00, a01, a02, a10, a11, a12, a20, a21, a22} {}
+
+        static constexpr auto identity() -> Mat3 {
+            return {};
+        }
+
+        static constexpr auto translation(Vec2f offset) -> Mat3 {
+            return {1.F, 0.F, offset.x, 0.F, 1.F, offset.y, 0.F, 0.F, 1.F};
+        }
+
+        static constexpr auto scale(Vec2f factors) -> Mat3 {
+            return {factors.x, 0.F, 0.F, 0.F, factors.y, 0.F, 0.F, 0.F, 1.F};
+        }
+
+        // Rotation taking +x onto the unit vector direction
+        static constexpr auto rotation(Vec2f direction) -> Mat3 {
+            return {direction.x, -direction.y, 0.F, direction.y, direction.x,
+                    0.F,         0.F,          0.F, 1.F};
+        }
+
+        // Same sense as sf::Transform::rotate
+        static auto rotation(float degrees) -> Mat3 {
+            float rad = degrees * static_cast<float>(M_PI) / 180.F;
+            return rotation(Vec2f(std::cos(rad), std::sin(rad)));
+        }
+
+        [[nodiscard]] constexpr auto operator()(int row, int col) const
+            -> float {
+            return m[(row * 3) + col];
+        }
+
+        [[nodiscard]] constexpr auto transformPoint(Vec2f p) const -> Vec2f {
+            return {(m[0] * p.x) + (m[1] * p.y) + m[2],
+                    (m[3] * p.x) + (m[4] * p.y) + m[5]};
+        }
+
+        // Ignores the translation, for directions and offsets
+        [[nodiscard]] constexpr auto transformVector(Vec2f v) const -> Vec2f {
+            return {(m[0] * v.x) + (m[1] * v.y), (m[3] * v.x) + (m[4] * v.y)};
+        }
+
+        [[nodiscard]] constexpr auto determinant() const -> float {
+            return (m[0] * ((m[4] * m[8]) - (m[5] * m[7]))) -
+                   (m[1] * ((m[3] * m[8]) - (m[5] * m[6]))) +
+                   (m[2] * ((m[3] * m[7]) - (m[4] * m[6])));
+        }
+
+        // Identity for a singular matrix, as sf::Transform::getInverse
+        [[nodiscard]] constexpr auto inverse() const -> Mat3 {
+            float det = determinant();
+            if (det == 0.F) {
+                return {};
+            }
+            float inv = 1.F / det;
+            return {((m[4] * m[8]) - (m[5] * m[7])) * inv,
+                    ((m[2] * m[7]) - (m[1] * m[8])) * inv,
+                    ((m[1] * m[5]) - (m[2] * m[4])) * inv,
+                    ((m[5] * m[6]) - (m[3] * m[8])) * inv,
+                    ((m[0] * m[8]) - (m[2] * m[6])) * inv,
+                    ((m[2] * m[3]) - (m[0] * m[5])) * inv,
+                    ((m[3] * m[7]) - (m[4] * m[6])) * inv,
+                    ((m[1] * m[6]) - (m[0] * m[7])) * inv,
+                    ((m[0] * m[4]) - (m[1] * m[3])) * inv};
+        }
+
+        friend constexpr auto operator*(const Mat3& a, const Mat3& b)
+            -> Mat3 {
+            Mat3 out;
+            for (int row = 0; row < 3; row++) {
+                for (int col = 0; col < 3; col++) {
+                    out.m[(row * 3) + col] =
+                        (a.m[row * 3] * b.m[col]) +
+                        (a.m[(row * 3) + 1] * b.m[3 + col]) +
+                        (a.m[(row * 3) + 2] * b.m[6 + col]);
+                }
+            }
+            return out;
+        }
+
+        friend constexpr auto operator*(const Mat3& a, Vec2f p) -> Vec2f {
+            return a.transformPoint(p);
+        }
+
+        friend constexpr auto operator==(const Mat3& a, const Mat3& b)
+            -> bool {
+            for (int i = 0; i < 9; i++) {
+                if (a.m[i] != b.m[i]) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        friend constexpr auto operator!=(const Mat3& a, const Mat3& b)
+            -> bool {
+            return !(a == b);
+        }
+    };
+}  // namespace simlab
@@ -0,0 +1,142 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+
+#include "simlab/core/Collision.hpp"
+#include "simlab/core/ContactGraph.hpp"
+#include "simlab/core/PolygonCollider.hpp"
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace simlab {
+
+    // Collider kinds ordered from cheapest to most general
+    enum class ColliderType : uint8_t { Circle, Box, Polygon, Count };
+
+    /**
+     * @brief Type-tagged handle for one body's collision geometry
+     * A circle is just its world center and radius. Boxes and polygons keep
+     * their cached vertices in the owning ColliderSet, at index geometry, so
+     * batches of circles never stream polygon buffers.
+     */
+    struct Collider {
+        ColliderType     type     = ColliderType::Circle;
+        std::uint32_t    geometry = 0;  // Box and polygon only
+        const sf::Shape* shape    = nullptr;
+        sf::Vector2f     center;
+        float            radius = 0.F;  // Circle only
+    };
+
+    // Geometry for box and polygon colliders
+    struct ColliderGeometry {
+        PolygonCollider polygon;
+
+        // Box: unit axes and half extents around the collider center
+        std::array<sf::Vector2f, 2> axes;
+        sf::Vector2f                halfExtents;
+    };
+
+    /**
+     * @brief Colliders indexed like the caller's bodies, plus the separate
+     * store of box and polygon geometry they refer to
+     * Call update() once per step after the shapes moved.
+     */
+    class ColliderSet {
+      public:
+
+        auto addCircle(const sf::CircleShape& circle) -> std::uint32_t;
+
+        auto addBox(const sf::RectangleShape& box) -> std::uint32_t;
+
+        auto addPolygon(const sf::Shape& polygon) -> std::uint32_t;
+
+        void update(std::uint32_t index);
+
+        void update();
+
+        void clear();
+
+        auto size() const -> std::size_t {
+            return m_colliders.size();
+        }
+
+        auto operator[](std::uint32_t index) const -> const Collider& {
+            return m_colliders[index];
+        }
+
+        auto getGeometry(const Collider& collider) const
+            -> const ColliderGeometry& {
+            return m_geometry[collider.geometry];
+        }
+
+      private:
+
+        auto add(ColliderType type, const sf::Shape& shape) -> std::uint32_t;
+
+        std::vector<Collider>         m_colliders;
+        std::vector<ColliderGeometry> m_geometry;
+    };
+
+    struct Contact {
+        ContactPair   pair;  // Normal points from pair.bodyA to pair.bodyB
+        CollisionInfo info;
+    };
+
+    /**
+     * @brief Narrow phase with a per-type-pair dispatch matrix
+     * Candidate pairs are bucketed by (typeA, typeB) so each specialized
+     * routine (circle-circle, circle-box, circle-polygon, box-box,
+     * box-polygon, polygon-polygon) runs over one contiguous batch.
+     */
+    class NarrowPhase {
+      public:
+
+        static constexpr std::size_t TypeCount =
+            static_cast<std::size_t>(ColliderType::Count);
+
+        using PairFunction = CollisionInfo (*)(const ColliderSet&,
+                                               const Collider&,
+                                               const Collider&);
+
+        /**
+         * @brief Test every candidate and append touching pairs to contacts
+         * Pairs are reordered so the cheaper collider type comes first
+         */
+        void run(const ColliderSet&              colliders,
+                 const std::vector<ContactPair>& candidates,
+                 std::vector<Contact>&           contacts);
+
+        // Routine used for (typeA, typeB) with typeA <= typeB
+        static auto getPairFunction(ColliderType typeA, ColliderType typeB)
+            -> PairFunction;
+
+        // Candidates per type pair in the last run(), row-major by type
+        auto getBatchSizes() const
+            -> const std::array<std::size_t, TypeCount * TypeCount>& {
+            return m_batchSizes;
+        }
+
+        static auto circleCircle(const ColliderSet& set, const Collider& a,
+                                 const Collider& b) -> CollisionInfo;
+
+        static auto circleBox(const ColliderSet& set, const Collider& a,
+                              const Collider& b) -> CollisionInfo;
+
+        static auto circlePolygon(const ColliderSet& set, const Collider& a,
+                                  const Collider& b) -> CollisionInfo;
+
+        static auto boxBox(const ColliderSet& set, const Collider& a,
+                           const Collider& b) -> CollisionInfo;
+
+        static auto polygonPolygon(const ColliderSet& set, const Collider& a,
+                                   const Collider& b) -> CollisionInfo;
+
+      private:
+
+        std::vector<ContactPair>                       m_sorted;
+        std::array<std::size_t, TypeCount * TypeCount> m_batchSizes{};
+    };
+
+}  // namespace simlab
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <SFML/Graphics/Color.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <vector>
+
+namespace simlab {
+
+    /**
+     * @brief Quantized color lookup table over t in [0, 1]
+     * Built once from any color function, then every lookup is an index
+     * computation and a load from a table that fits in L1. Periodic
+     * palettes (hues) wrap t; the others clamp it. Sizes must be powers of
+     * two.
+     */
+    class Palette {
+      public:
+
+        static constexpr std::size_t DefaultSize = 1024;
+
+        Palette(const std::function<sf::Color(float t)>& color,
+                std::size_t size = DefaultSize, bool periodic = false);
+
+        // utils::HSVtoRGB with hue t, one turn per unit
+        static auto hsv(float saturation = 1.F, float value = 1.F,
+                        std::size_t size = DefaultSize) -> Palette;
+
+        // utils::HSLtoRGB with hue 360 t degrees
+        static auto hsl(float saturation = 1.F, float lightness = 0.5F,
+                        std::size_t size = DefaultSize) -> Palette;
+
+        // Perceptually uniform, from matplotlib's viridis
+        static auto viridis(std::size_t size = DefaultSize) -> Palette;
+
+        // Evenly spaced stops, linearly interpolated
+        static auto gradient(std::initializer_list<sf::Color> stops,
+                             std::size_t size = DefaultSize) -> Palette;
+
+        auto operator()(float t) const -> sf::Color {
+            return m_table[index(t)];
+        }
+
+        /**
+         * @brief Colors for a whole scalar field, lo mapping to t = 0 and
+         * hi to t = 1. Indices are computed in chunks with a branch-free
+         * loop the compiler vectorizes, then gathered
+         */
+        void map(const float* values, sf::Color* out, std::size_t n,
+                 float lo = 0.F, float hi = 1.F) const;
+
+        auto map(const std::vector<float>& values, float lo = 0.F,
+                 float hi = 1.F) const -> std::vector<sf::Color>;
+
+        auto size() const -> std::size_t {
+            return m_table.size();
+        }
+
+        auto isPeriodic() const -> bool {
+            return m_periodic;
+        }
+
+      private:
+
+        auto index(float t) const -> std::size_t {
+            float scaled = t * static_cast<float>(m_table.size());
+            return m_periodic ? wrapBin(scaled) : clampBin(scaled);
+        }
+
+        /**
+         * @brief floor(scaled) modulo the table size
+         * NaN lands in bin 0 and bins past +-2^30, infinities included,
+         * saturate first, so the int32 conversion is always defined
+         */
+        auto wrapBin(float scaled) const -> std::uint32_t {
+            constexpr float Limit = 0x1.0p30F;
+
+            float bin = std::floor(scaled);
+            bin       = bin > -Limit ? bin : -Limit;  // Also catches NaN
+            bin       = bin < Limit ? bin : Limit;
+            return static_cast<std::uint32_t>(static_cast<std::int32_t>(bin)) &
+                   static_cast<std::uint32_t>(m_mask);
+        }
+
+        auto clampBin(float scaled) const -> std::uint32_t {
+            scaled = scaled > 0.F ? scaled : 0.F;  // Also catches NaN
+            scaled = scaled < m_last ? scaled : m_last;
+            return static_cast<std::uint32_t>(scaled);
+        }
+
+        std::vector<sf::Color> m_table;
+        std::size_t            m_mask;
+        float                  m_last;  // Highest index, as a float
+        bool                   m_periodic;
+    };
+
+}  // namespace simlab
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+namespace simlab {
+
+    /**
+     * @brief Per-thread hardware counters through perf_event_open (Linux)
+     * Each thread lazily opens one counter group the first time it reads.
+     * Counters the kernel or CPU refuses (perf_event_paranoid, VMs without
+     * a PMU, other platforms) are left out of Sample::validMask instead of
+     * failing, so callers can always read and just report less.
+     */
+    class PerfCounters {
+      public:
+
+        enum Counter : std::uint8_t {
+            Cycles,
+            Instructions,
+            L1DMisses,
+            LLCMisses,
+            BranchMisses,
+            Count
+        };
+
+        struct Sample {
+            std::array<std::uint64_t, Count> values{};
+            std::uint32_t                    validMask = 0;
+
+            auto isValid(Counter counter) const -> bool {
+                return (validMask & (1U << counter)) != 0;
+            }
+
+            // Per-counter end - start; only counters valid in both survive
+            auto operator-(const Sample& start) const -> Sample {
+                Sample delta;
+                delta.validMask = validMask & start.validMask;
+                for (std::size_t i = 0; i < Count; i++) {
+                    delta.values[i] = values[i] >= start.values[i]
+                                          ? values[i] - start.values[i]
+                                          : 0;
+                }
+                return delta;
+            }
+        };
+
+        // Current totals of the calling thread, scaled for multiplexing
+        static auto read() -> Sample;
+
+        // True when the calling thread got at least one counter
+        static auto isAvailable() -> bool;
+
+        static auto getName(Counter counter) -> const char*;
+    };
+
+}  // namespace simlab
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+
+#include "simlab/core/PhysicsManager.hpp"
+
+#include <array>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace simlab {
+
+    /**
+     * @brief Live frame/physics timing panel with a scrolling graph
+     * Text uses a built-in 3x5 pixel font, so no font file is needed, and
+     * the whole panel goes out as one untextured triangle batch
+     */
+    class PerformanceOverlay {
+      public:
+
+        static constexpr std::size_t HistoryLength = 240;  // ~4 s at 60 FPS
+
+        PerformanceOverlay();
+
+        void toggle() {
+            m_visible = !m_visible;
+        }
+
+        void setVisible(bool visible) {
+            m_visible = visible;
+        }
+
+        auto isVisible() const -> bool {
+            return m_visible;
+        }
+
+        // Unscaled wall time of the last frame
+        void recordFrame(float frameSeconds);
+
+        void setTargetFPS(float fps) {
+            m_targetFPS = fps;
+        }
+
+        void setPhysicsStats(const PhysicsManager::PerformanceStats& stats);
+
+        /**
+         * @brief Show a named value under the timings
+         * Safe to call from the physics thread
+         */
+        void setCounter(const std::string& name, double value);
+
+        void removeCounter(const std::string& name);
+
+        // Rebuild the panel and issue its single draw call
+        void draw(sf::RenderTarget& target);
+
+        // Bitmap font cell size, in font pixels
+        static constexpr int GlyphWidth  = 3;
+        static constexpr int GlyphHeight = 5;
+
+      private:
+
+        void appendQuad(float left, float top, float width, float height,
+                        sf::Color color);
+
+        void appendText(sf::Vector2f position, std::string_view text,
+                        sf::Color color);
+
+        void appendGraph(sf::Vector2f position, sf::Vector2f size);
+
+        bool  m_visible   = false;
+        float m_targetFPS = 60.F;
+        float m_pixelSize = 2.F;
+
+        // Ring buffers, newest sample at m_head - 1
+        std::array<float, HistoryLength> m_frameMs{};
+        std::array<float, HistoryLength> m_physicsMs{};
+        std::size_t                      m_head    = 0;
+        std::size_t                      m_samples = 0;
+
+        bool                             m_hasPhysics = false;
+        PhysicsManager::PerformanceStats m_physics{};
+
+        std::mutex                                  m_counterMutex;
+        std::vector<std::pair<std::string, double>> m_counters;
+
+        // Reused every frame so drawing does not allocate
+        std::vector<sf::Vertex>             m_vertices;
+        std::string                         m_line;
+        std::chrono::steady_clock::duration m_buildTime{};
+    };
+
+}  // namespace simlab
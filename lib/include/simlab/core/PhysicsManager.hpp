@@ -67,6 +67,7 @@ namespace simlab {
 
         // Statistics
         std::atomic<float>    m_actualFPS{0.0F};
+        std::atomic<float>    m_stepTimeMs{0.0F};  // Last update, wall time
         std::atomic<uint64_t> m_totalUpdates{0};
 
       public:
@@ -167,6 +168,10 @@ namespace simlab {
             return m_actualFPS.load();
         }
 
+        auto getStepTimeMs() const -> float {
+            return m_stepTimeMs.load();
+        }
+
         auto getTargetFPS() const -> float {
             return m_targetFPS;
         }
@@ -197,6 +202,7 @@ namespace simlab {
             ThreadState state;
             float       maxDeltaTime;
             int         maxSubSteps;
+            float       stepTimeMs;
         };
 
         auto getPerformanceStats() const -> PerformanceStats;
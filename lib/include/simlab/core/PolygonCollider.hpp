@@ -0,0 +1,136 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+
+namespace simlab {
+
+    /**
+     * @brief World-space convex polygon cached from an sf::Shape
+     * Vertices and unit outward edge normals live in fixed inline buffers and
+     * are only recomputed when the shape's transform changes. Call
+     * invalidate() after changing local geometry (radius, size, points).
+     */
+    class PolygonCollider {
+      public:
+
+        // sf::CircleShape defaults to 30 points
+        static constexpr std::size_t MaxVertices = 32;
+
+        PolygonCollider() = default;
+
+        explicit PolygonCollider(const sf::Shape& shape) {
+            update(shape);
+        }
+
+        // Refresh cached geometry if needed; returns true if it was rebuilt
+        auto update(const sf::Shape& shape) -> bool {
+            // Only the 2D affine part of SFML's 4x4 matrix matters
+            const float*         matrix = shape.getTransform().getMatrix();
+            std::array<float, 6> affine = {matrix[0], matrix[1],  matrix[4],
+                                           matrix[5], matrix[12], matrix[13]};
+
+            if (m_valid && affine == m_affine &&
+                shape.getPointCount() == m_count) {
+                return false;
+            }
+
+            rebuild(shape, affine);
+            return true;
+        }
+
+        void invalidate() {
+            m_valid = false;
+        }
+
+        auto getVertexCount() const -> std::size_t {
+            return m_count;
+        }
+
+        auto getVertices() const -> const sf::Vector2f* {
+            return m_vertices.data();
+        }
+
+        // normals[i] is the outward normal of edge (i, i + 1); zero if the
+        // edge is degenerate
+        auto getNormals() const -> const sf::Vector2f* {
+            return m_normals.data();
+        }
+
+        auto getCentroid() const -> sf::Vector2f {
+            return m_centroid;
+        }
+
+        // Farthest vertex along direction
+        auto support(const sf::Vector2f& direction) const -> sf::Vector2f {
+            std::size_t best     = 0;
+            float       bestProj = -std::numeric_limits<float>::max();
+            for (std::size_t i = 0; i < m_count; i++) {
+                float proj = (m_vertices[i].x * direction.x) +
+                             (m_vertices[i].y * direction.y);
+                if (proj > bestProj) {
+                    bestProj = proj;
+                    best     = i;
+                }
+            }
+            return m_vertices[best];
+        }
+
+      private:
+
+        void rebuild(const sf::Shape& shape,
+                     const std::array<float, 6>& affine) {
+            std::size_t count = shape.getPointCount();
+            if (count > MaxVertices) {
+                throw std::length_error(
+                    "PolygonCollider: shape has more than MaxVertices points");
+            }
+
+            const sf::Transform& transform = shape.getTransform();
+
+            m_centroid       = {0.F, 0.F};
+            float signedArea = 0.F;
+            for (std::size_t i = 0; i < count; i++) {
+                m_vertices[i] = transform.transformPoint(shape.getPoint(i));
+                m_centroid += m_vertices[i];
+            }
+            for (std::size_t i = 0; i < count; i++) {
+                const auto& p1 = m_vertices[i];
+                const auto& p2 = m_vertices[(i + 1) % count];
+                signedArea += (p1.x * p2.y) - (p2.x * p1.y);
+            }
+            if (count > 0) {
+                m_centroid /= static_cast<float>(count);
+            }
+
+            // (edge.y, -edge.x) points outward for positive signed area
+            float orientation = signedArea >= 0.F ? 1.F : -1.F;
+            for (std::size_t i = 0; i < count; i++) {
+                sf::Vector2f edge =
+                    m_vertices[(i + 1) % count] - m_vertices[i];
+                float len = std::sqrt((edge.x * edge.x) + (edge.y * edge.y));
+
+                m_normals[i] = len > 0.F ? sf::Vector2f(edge.y, -edge.x) *
+                                               (orientation / len)
+                                         : sf::Vector2f(0.F, 0.F);
+            }
+
+            m_count  = count;
+            m_affine = affine;
+            m_valid  = true;
+        }
+
+        std::array<sf::Vector2f, MaxVertices> m_vertices;
+        std::array<sf::Vector2f, MaxVertices> m_normals;
+        sf::Vector2f                          m_centroid;
+        std::size_t                           m_count = 0;
+        std::array<float, 6>                  m_affine{};
+        bool                                  m_valid = false;
+    };
+
+}  // namespace simlab
@@ -0,0 +1,162 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+namespace simlab {
+
+    /**
+     * @brief Hierarchical zone profiler with Chrome trace export
+     * Every thread appends begin/end events to its own chunked buffer
+     * without locks; exportTrace() writes the Trace Event JSON that
+     * chrome://tracing and ui.perfetto.dev load. Recording is off until
+     * start() or until SIMLAB_TRACE_EXPORT=<path> is set, in which case the
+     * trace is written at process exit. With allocation tracking compiled
+     * in, each zone also reports what it allocated.
+     */
+    class Profiler {
+      public:
+
+        enum class EventType : std::uint8_t { Begin, End };
+
+        struct Event {
+            const char*   name;         // Must outlive the profiler
+            std::uint64_t timestamp;    // ns since the profiler epoch
+            std::uint64_t allocations;  // Thread's running totals, see
+            std::uint64_t bytes;        // AllocationTracker
+            EventType     type;
+        };
+
+        static constexpr std::size_t ChunkSize = 4096;
+        static constexpr std::size_t MaxChunks = 256;  // ~1M events/thread
+
+        // Events of one thread; only that thread writes
+        class ThreadBuffer {
+          public:
+
+            ThreadBuffer(std::uint32_t threadId, std::string threadName);
+
+            ThreadBuffer(const ThreadBuffer&)                    = delete;
+            ThreadBuffer(ThreadBuffer&&)                         = delete;
+            auto operator=(const ThreadBuffer&) -> ThreadBuffer& = delete;
+            auto operator=(ThreadBuffer&&) -> ThreadBuffer&      = delete;
+
+            ~ThreadBuffer();
+
+            void push(const char* name, EventType type);
+
+            // Number of events published so far; safe from any thread
+            auto size() const -> std::size_t {
+                return m_size.load(std::memory_order_acquire);
+            }
+
+            auto at(std::size_t index) const -> const Event& {
+                return m_chunks[index / ChunkSize].load(
+                    std::memory_order_relaxed)[index % ChunkSize];
+            }
+
+            auto getThreadId() const -> std::uint32_t {
+                return m_threadId;
+            }
+
+            auto getDropped() const -> std::uint64_t {
+                return m_dropped.load(std::memory_order_relaxed);
+            }
+
+            auto getThreadName() const -> std::string;
+
+            void setThreadName(std::string name);
+
+          private:
+
+            std::array<std::atomic<Event*>, MaxChunks> m_chunks{};
+            std::atomic<std::size_t>                   m_size{0};
+            std::atomic<std::uint64_t>                 m_dropped{0};
+            std::uint32_t                              m_threadId;
+
+            mutable std::mutex m_nameMutex;
+            std::string        m_threadName;
+        };
+
+        static void start();
+
+        static void stop();
+
+        static auto isEnabled() -> bool {
+            return s_enabled.load(std::memory_order_relaxed);
+        }
+
+        // Label the calling thread in the trace viewer
+        static void setThreadName(const std::string& name);
+
+        static void beginZone(const char* name) {
+            threadBuffer().push(name, EventType::Begin);
+        }
+
+        static void endZone(const char* name) {
+            threadBuffer().push(name, EventType::End);
+        }
+
+        /**
+         * @brief Write every thread's events as Chrome trace-event JSON
+         * May run while other threads keep recording; their newer events
+         * are simply not included
+         */
+        static void exportTrace(const std::string& path);
+
+        // Events lost because a thread filled all of its chunks
+        static auto getDroppedCount() -> std::uint64_t;
+
+      private:
+
+        static auto threadBuffer() -> ThreadBuffer&;
+
+        static inline std::atomic<bool> s_enabled{false};
+    };
+
+    // RAII zone; records nothing when the profiler was off at construction
+    class ProfileZone {
+      public:
+
+        explicit ProfileZone(const char* name)
+            : m_name(Profiler::isEnabled() ? name : nullptr) {
+            if (m_name != nullptr) {
+                Profiler::beginZone(m_name);
+            }
+        }
+
+        ProfileZone(const ProfileZone&)                    = delete;
+        ProfileZone(ProfileZone&&)                         = delete;
+        auto operator=(const ProfileZone&) -> ProfileZone& = delete;
+        auto operator=(ProfileZone&&) -> ProfileZone&      = delete;
+
+        ~ProfileZone() {
+            if (m_name != nullptr) {
+                Profiler::endZone(m_name);
+            }
+        }
+
+      private:
+
+        const char* m_name;
+    };
+
+}  // namespace simlab
+
+// Zones compile away entirely unless SIMLAB_ENABLE_PROFILER is defined
+#ifdef SIMLAB_ENABLE_PROFILER
+#define SIMLAB_PROFILE_CONCAT_IMPL(a, b) a##b
+#define SIMLAB_PROFILE_CONCAT(a, b)      SIMLAB_PROFILE_CONCAT_IMPL(a, b)
+#define SIMLAB_PROFILE_ZONE(name)                                      \
+    const simlab::ProfileZone SIMLAB_PROFILE_CONCAT(profileZone_,      \
+                                                    __LINE__)(name)
+#define SIMLAB_PROFILE_FUNCTION() SIMLAB_PROFILE_ZONE(__func__)
+#define SIMLAB_PROFILE_THREAD(name) simlab::Profiler::setThreadName(name)
+#else
+#define SIMLAB_PROFILE_ZONE(name)   ((void)0)
+#define SIMLAB_PROFILE_FUNCTION()   ((void)0)
+#define SIMLAB_PROFILE_THREAD(name) ((void)0)
+#endif
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace simlab {
+
+    /**
+     * @brief xoshiro256** generator with uniform, normal and angle samples
+     * 32 bytes of state and a handful of shifts per draw, against 5 KB and
+     * a twist for std::mt19937. Satisfies UniformRandomBitGenerator, so
+     * std distributions still work on it where needed.
+     *
+     * Reproducibility comes from one global seed: SIMLAB_SEED in the
+     * environment or setGlobalSeed(), otherwise std::random_device.
+     * stream(i) is the i-th generator derived from it, and threadLocal()
+     * hands each thread its own stream, numbered in the order threads
+     * first ask, so runs repeat whenever that order does.
+     */
+    class Random {
+      public:
+
+        using result_type = std::uint64_t;
+
+        explicit Random(std::uint64_t seed);
+
+        static constexpr auto min() -> result_type {
+            return 0;
+        }
+
+        static constexpr auto max() -> result_type {
+            return std::numeric_limits<result_type>::max();
+        }
+
+        auto operator()() -> result_type {
+            const result_type result = rotl(m_state[1] * 5, 7) * 9;
+            const result_type t      = m_state[1] << 17;
+
+            m_state[2] ^= m_state[0];
+            m_state[3] ^= m_state[1];
+            m_state[1] ^= m_state[2];
+            m_state[0] ^= m_state[3];
+            m_state[2] ^= t;
+            m_state[3]  = rotl(m_state[3], 45);
+            return result;
+        }
+
+        // [0, 1) from the top 24 bits, every value exactly representable
+        auto nextFloat() -> float {
+            return static_cast<float>((*this)() >> 40) * 0x1.0p-24F;
+        }
+
+        auto nextDouble() -> double {
+            return static_cast<double>((*this)() >> 11) * 0x1.0p-53;
+        }
+
+        // [lo, hi)
+        auto uniform(float lo, float hi) -> float {
+            return lo + ((hi - lo) * nextFloat());
+        }
+
+        // [lo, hi], unbiased
+        auto uniformInt(int lo, int hi) -> int;
+
+        auto chance(double probability) -> bool {
+            return nextDouble() < probability;
+        }
+
+        // [0, 2 pi)
+        auto angle() -> float;
+
+        auto normal(float mean = 0.F, float stddev = 1.F) -> float;
+
+        void fillUniform(float* out, std::size_t n, float lo = 0.F,
+                         float hi = 1.F);
+        void fillNormal(float* out, std::size_t n, float mean = 0.F,
+                        float stddev = 1.F);
+        void fillAngle(float* out, std::size_t n);
+
+        /**
+         * @brief Returns a generator continuing this stream and jumps this
+         * one 2^128 draws ahead, so the two never overlap
+         */
+        auto split() -> Random;
+
+        static void setGlobalSeed(std::uint64_t seed);
+        static auto getGlobalSeed() -> std::uint64_t;
+
+        // Same global seed and index, same sequence
+        static auto stream(std::uint64_t index) -> Random;
+
+        // Reseeded automatically after setGlobalSeed()
+        static auto threadLocal() -> Random&;
+
+      private:
+
+        static constexpr auto rotl(result_type x, int k) -> result_type {
+            return (x << k) | (x >> (64 - k));
+        }
+
+        void jump();
+
+        std::array<result_type, 4> m_state{};
+        float                      m_spare    = 0.F;
+        bool                       m_hasSpare = false;
+    };
+}  // namespace simlab
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Shape.hpp>
+#include <SFML/Graphics/Transform.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include "simlab/core/Mat3.hpp"
+#include "simlab/core/SignedDistanceField.hpp"
+#include "simlab/core/Vec2.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace simlab {
+
+    /**
+     * @brief Conversions between the headless core types and SFML
+     * Only rendering code includes this; everything else stays on Vec2
+     * and Mat3. The vector casts are member copies the optimizer folds
+     * away entirely. The SFML-side obstacle rasterizers for the headless
+     * SignedDistanceField live here too.
+     */
+
+    template <typename T>
+    inline auto toSf(const Vec2<T>& v) -> sf::Vector2<T> {
+        return {v.x, v.y};
+    }
+
+    template <typename T>
+    constexpr auto fromSf(const sf::Vector2<T>& v) -> Vec2<T> {
+        return {v.x, v.y};
+    }
+
+    inline auto toSf(const Mat3& m) -> sf::Transform {
+        return {m.m[0], m.m[1], m.m[2], m.m[3], m.m[4],
+                m.m[5], m.m[6], m.m[7], m.m[8]};
+    }
+
+    // sf::Transform keeps a column-major 4x4 for OpenGL
+    inline auto fromSf(const sf::Transform& t) -> Mat3 {
+        const float* a = t.getMatrix();
+        return {a[0], a[4], a[12], a[1], a[5], a[13], a[3], a[7], a[15]};
+    }
+
+    // Any sf::Shape (convex or not) using its current transform
+    inline void addShape(SignedDistanceField& field, const sf::Shape& shape) {
+        std::vector<Vec2f> points(shape.getPointCount());
+        for (std::size_t i = 0; i < points.size(); i++) {
+            points[i] = fromSf(shape.getPoint(i));
+        }
+        field.addPolygon(points, fromSf(shape.getTransform()));
+    }
+
+    // Solid wherever pixel alpha >= alphaThreshold, one pixel per unit
+    inline void addImage(SignedDistanceField& field, const sf::Image& image,
+                         sf::Vector2f position,
+                         sf::Uint8    alphaThreshold = 128) {
+        sf::Vector2u              size = image.getSize();
+        std::vector<std::uint8_t> mask(static_cast<std::size_t>(size.x) *
+                                       size.y);
+        for (unsigned y = 0; y < size.y; y++) {
+            for (unsigned x = 0; x < size.x; x++) {
+                mask[(static_cast<std::size_t>(y) * size.x) + x] =
+                    image.getPixel(x, y).a >= alphaThreshold ? 1 : 0;
+            }
+        }
+        field.addMask(mask, static_cast<int>(size.x),
+                      static_cast<int>(size.y), fromSf(position));
+    }
+}  // namespace simlab
@@ -0,0 +1,132 @@
+#pragma once
+
+#include "simlab/core/Mat3.hpp"
+#include "simlab/core/ThreadPool.hpp"
+#include "simlab/core/Vec2.hpp"
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace simlab {
+
+    /**
+     * @brief Signed distance grid of the static world
+     * Obstacles are rasterized into an occupancy mask, then build() turns it
+     * into distances with a jump-flood pass per sign. Distances are positive
+     * in free space and negative inside obstacles, so any body can query its
+     * clearance and push-out direction in O(1). SfmlInterop.hpp rasterizes
+     * sf::Shape and sf::Image obstacles into it.
+     */
+    class SignedDistanceField {
+      public:
+
+        SignedDistanceField() = default;
+
+        SignedDistanceField(Vec2f origin, Vec2f size, float cellSize);
+
+        // Resize to cover [origin, origin + size] and clear every obstacle
+        void reset(Vec2f origin, Vec2f size, float cellSize);
+
+        void clear();
+
+        // ========== OBSTACLES ==========
+
+        void addRectangle(Vec2f position, Vec2f size);
+
+        // Any simple polygon (convex or not), points mapped by transform
+        void addPolygon(const std::vector<Vec2f>& points,
+                        const Mat3&               transform = {});
+
+        /**
+         * @brief Solid wherever mask is non-zero, one mask cell per unit
+         * mask holds width * height bytes row by row, its top-left corner
+         * at position
+         */
+        void addMask(const std::vector<std::uint8_t>& mask, int width,
+                     int height, Vec2f position);
+
+        // Solid band of the given thickness along the grid border
+        void addFrame(float thickness);
+
+        // Mark a single cell, e.g. from a maze or automaton grid
+        void setCell(int col, int row, bool solid);
+
+        // ========== DISTANCE FIELD ==========
+
+        // Rebuild distances after obstacles changed
+        void build();
+
+        // Same as build(), rows split across the pool
+        void build(ThreadPool& pool);
+
+        /**
+         * @brief Bilinear signed distance at a world position
+         * Positions outside the grid are clamped to its border
+         */
+        auto sample(Vec2f position) const -> float;
+
+        // Unit direction of increasing distance (away from obstacles)
+        auto gradient(Vec2f position) const -> Vec2f;
+
+        auto getOrigin() const -> Vec2f {
+            return m_origin;
+        }
+
+        auto getSize() const -> Vec2f {
+            return m_size;
+        }
+
+        auto getCellSize() const -> float {
+            return m_cellSize;
+        }
+
+        auto getGridSize() const -> Vec2i {
+            return {m_cols, m_rows};
+        }
+
+        auto isSolid(int col, int row) const -> bool {
+            return m_solid[index(col, row)] != 0;
+        }
+
+      private:
+
+        auto index(int col, int row) const -> std::size_t {
+            return (static_cast<std::size_t>(row) * m_cols) + col;
+        }
+
+        auto cellCenter(int col, int row) const -> Vec2f {
+            return {m_origin.x + ((col + 0.5F) * m_cellSize),
+                    m_origin.y + ((row + 0.5F) * m_cellSize)};
+        }
+
+        // Continuous cell coordinates with the cell centers on integers
+        auto toGrid(Vec2f position) const -> Vec2f;
+
+        // Runs a row-range kernel either inline or across a pool
+        using RowRunner =
+            std::function<void(const ThreadPool::RangeFunction&)>;
+
+        // Jump flood: nearest cell whose solid flag equals seedSolid
+        void jumpFlood(bool seedSolid, std::vector<std::int32_t>& nearest,
+                       const RowRunner& forRows);
+
+        void buildWith(const RowRunner& forRows);
+
+        Vec2f m_origin;
+        Vec2f m_size;
+        float m_cellSize    = 1.F;
+        float m_invCellSize = 1.F;
+        int   m_cols        = 0;
+        int   m_rows        = 0;
+
+        std::vector<std::uint8_t> m_solid;
+        std::vector<float>        m_distance;
+
+        // Jump-flood ping-pong buffers, kept between rebuilds
+        std::vector<std::int32_t> m_nearestSolid;
+        std::vector<std::int32_t> m_nearestEmpty;
+        std::vector<std::int32_t> m_scratch;
+    };
+
+}  // namespace simlab
@@ -0,0 +1,93 @@
+#pragma once
+
+#include "simlab/core/ContactGraph.hpp"
+#include "simlab/core/Vec2.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace simlab {
+
+    struct SleepSettings {
+        float linearThreshold = 5.F;   // Speed (units/s) considered at rest
+        float timeToSleep     = 0.5F;  // Seconds at rest before sleeping
+    };
+
+    /**
+     * @brief Per-body sleep tracking grouped into simulation islands
+     * Islands are the connected components of the contact graph. An island
+     * only sleeps once every body in it has been at rest for timeToSleep,
+     * and the whole island wakes when an awake body touches it or one of its
+     * bodies receives an external impulse. Callers skip sleeping bodies in
+     * integration and skip pairs where both bodies sleep in the narrow phase.
+     */
+    class SleepManager {
+      public:
+
+        explicit SleepManager(SleepSettings settings = {});
+
+        // Grow or shrink the tracked body range; new bodies start awake
+        void resize(std::size_t bodyCount);
+
+        /**
+         * @brief Advance rest timers, rebuild islands from this step's
+         * contacts and put fully resting islands to sleep
+         * Velocities of bodies that fall asleep are zeroed.
+         */
+        void update(const std::vector<ContactPair>& contacts,
+                    std::vector<Vec2f>& velocities, float dt);
+
+        // Wake the island containing body
+        void wake(std::size_t body);
+
+        void wakeAll();
+
+        auto isAwake(std::size_t body) const -> bool {
+            return m_awake[body] != 0;
+        }
+
+        // True if the narrow phase needs to look at this pair
+        auto isPairActive(std::size_t bodyA, std::size_t bodyB) const -> bool {
+            return isAwake(bodyA) || isAwake(bodyB);
+        }
+
+        auto getSleepingCount() const -> std::size_t;
+
+        auto getIslandCount() const -> std::size_t {
+            return m_islandCount;
+        }
+
+        void setSettings(SleepSettings settings) {
+            m_settings = settings;
+        }
+
+        auto getSettings() const -> const SleepSettings& {
+            return m_settings;
+        }
+
+      private:
+
+        auto findRoot(std::uint32_t body) -> std::uint32_t;
+
+        void unite(std::uint32_t bodyA, std::uint32_t bodyB);
+
+        void wakeIsland(std::uint32_t island);
+
+        // Rebuild island membership lists (CSR) from m_islandIds
+        void rebuildMembership();
+
+        SleepSettings m_settings;
+
+        std::vector<std::uint8_t>  m_awake;
+        std::vector<float>         m_restTime;
+        std::vector<std::uint32_t> m_parent;     // Union-find scratch
+        std::vector<std::uint32_t> m_islandIds;  // Root body of each island
+        std::vector<float>         m_islandRest;
+
+        // Bodies of island i are m_islandBodies[offsets[i], offsets[i + 1])
+        std::vector<std::uint32_t> m_islandOffsets;
+        std::vector<std::uint32_t> m_islandBodies;
+        std::size_t                m_islandCount = 0;
+    };
+
+}  // namespace simlab
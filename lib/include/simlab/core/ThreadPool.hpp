@@ -0,0 +1,78 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace simlab {
+
+    /**
+     * @brief Persistent worker pool for data-parallel loops
+     * Workers sleep between jobs; the calling thread joins in on every
+     * parallelFor so a pool of N threads uses N + 1 cores
+     */
+    class ThreadPool {
+      public:
+
+        // Receives a half-open index range [begin, end)
+        using RangeFunction =
+            std::function<void(std::size_t begin, std::size_t end)>;
+
+        ThreadPool(const ThreadPool&)                    = delete;
+        ThreadPool(ThreadPool&&)                         = delete;
+        auto operator=(const ThreadPool&) -> ThreadPool& = delete;
+        auto operator=(ThreadPool&&) -> ThreadPool&      = delete;
+
+        /**
+         * @brief Spawn workerCount background threads
+         * The default leaves one hardware thread for the caller
+         */
+        explicit ThreadPool(std::size_t workerCount = defaultWorkerCount());
+
+        ~ThreadPool();
+
+        /**
+         * @brief Run func over [0, count) split into chunks of at least
+         * minChunk indices, blocking until every chunk has finished
+         * Small ranges run inline on the calling thread
+         */
+        void parallelFor(std::size_t count, const RangeFunction& func,
+                         std::size_t minChunk = 64);
+
+        auto getWorkerCount() const -> std::size_t {
+            return m_workers.size();
+        }
+
+        static auto defaultWorkerCount() -> std::size_t {
+            auto hardware = std::thread::hardware_concurrency();
+            return hardware > 1 ? hardware - 1 : 0;
+        }
+
+      private:
+
+        void workerLoop();
+
+        // Pull chunks of the current job until none are left
+        void runChunks();
+
+        std::vector<std::thread> m_workers;
+        std::mutex               m_mutex;
+        std::condition_variable  m_startCondition;
+        std::condition_variable  m_doneCondition;
+        bool                     m_stopping = false;
+
+        // Current job, published under m_mutex
+        const RangeFunction*     m_job         = nullptr;
+        std::size_t              m_jobCount    = 0;
+        std::size_t              m_chunkSize   = 0;
+        std::uint64_t            m_generation  = 0;
+        std::size_t              m_busyWorkers = 0;
+        std::atomic<std::size_t> m_nextIndex{0};
+    };
+
+}  // namespace simlab
@@ -0,0 +1,135 @@
+#pragma once
+
+#include <fmt/format.h>
+
+#include <cmath>
+
+namespace simlab {
+
+    /**
+     * @brief 2D vector value type with no graphics dependency
+     * Everything short of a square root is constexpr. Aligned to its own
+     * size so a Vec2f moves as one 64-bit lane and arrays of them pair up
+     * cleanly in SIMD registers. SfmlInterop.hpp converts to and from
+     * sf::Vector2 at the render boundary.
+     */
+    template <typename T>
+    struct alignas(2 * sizeof(T)) Vec2 {
+        T x{};
+        T y{};
+
+        constexpr Vec2() = default;
+        constexpr Vec2(T x, T y) : x(x), y(y) {}
+
+        template <typename U>
+        constexpr explicit Vec2(const Vec2<U>& other)
+            : x(static_cast<T>(other.x)), y(static_cast<T>(other.y)) {}
+
+        constexpr auto operator+=(const Vec2& other) -> Vec2& {
+            x += other.x;
+            y += other.y;
+            return *this;
+        }
+
+        constexpr auto operator-=(const Vec2& other) -> Vec2& {
+            x -= other.x;
+            y -= other.y;
+            return *this;
+        }
+
+        constexpr auto operator*=(T scalar) -> Vec2& {
+            x *= scalar;
+            y *= scalar;
+            return *this;
+        }
+
+        constexpr auto operator/=(T scalar) -> Vec2& {
+            x /= scalar;
+            y /= scalar;
+            return *this;
+        }
+
+        [[nodiscard]] constexpr auto dot(const Vec2& other) const -> T {
+            return (x * other.x) + (y * other.y);
+        }
+
+        // z of the 3D cross product; positive when other is counter-clockwise
+        [[nodiscard]] constexpr auto cross(const Vec2& other) const -> T {
+            return (x * other.y) - (y * other.x);
+        }
+
+        [[nodiscard]] constexpr auto lengthSquared() const -> T {
+            return dot(*this);
+        }
+
+        // Rotated a quarter turn counter-clockwise
+        [[nodiscard]] constexpr auto perpendicular() const -> Vec2 {
+            return {-y, x};
+        }
+
+        [[nodiscard]] auto length() const -> T {
+            return static_cast<T>(std::sqrt(lengthSquared()));
+        }
+
+        // Zero stays zero
+        [[nodiscard]] auto normalized() const -> Vec2 {
+            T len = length();
+            return len != T{} ? Vec2(x / len, y / len) : Vec2();
+        }
+
+        friend constexpr auto operator+(Vec2 a, const Vec2& b) -> Vec2 {
+            return a += b;
+        }
+
+        friend constexpr auto operator-(Vec2 a, const Vec2& b) -> Vec2 {
+            return a -= b;
+        }
+
+        friend constexpr auto operator-(const Vec2& v) -> Vec2 {
+            return {-v.x, -v.y};
+        }
+
+        friend constexpr auto operator*(Vec2 v, T scalar) -> Vec2 {
+            return v *= scalar;
+        }
+
+        friend constexpr auto operator*(T scalar, Vec2 v) -> Vec2 {
+            return v *= scalar;
+        }
+
+        friend constexpr auto operator/(Vec2 v, T scalar) -> Vec2 {
+            return v /= scalar;
+        }
+
+        friend constexpr auto operator==(const Vec2& a, const Vec2& b)
+            -> bool {
+            return a.x == b.x && a.y == b.y;
+        }
+
+        friend constexpr auto operator!=(const Vec2& a, const Vec2& b)
+            -> bool {
+            return !(a == b);
+        }
+    };
+
+    using Vec2f = Vec2<float>;
+    using Vec2d = Vec2<double>;
+    using Vec2i = Vec2<int>;
+
+    static_assert(sizeof(Vec2f) == 8 && alignof(Vec2f) == 8);
+}  // namespace simlab
+
+// Here rather than in formatter.hpp, which needs SFML
+template <typename T>
+struct fmt::formatter<simlab::Vec2<T>> {
+    constexpr auto parse(fmt::format_parse_context& ctx)
+        -> decltype(ctx.begin()) {
+        return ctx.end();
+    }
+
+    template <typename FormatContext>
+    auto format(const simlab::Vec2<T>& v, FormatContext& ctx)
+        -> decltype(ctx.out()) {
+        return fmt::format_to(ctx.out(), "({}, {})", v.x, v.y);
+    }
+};
@@ -3,8 +3,12 @@
 
 #include <SFML/Graphics.hpp>
 
+#include "simlab/core/FastMath.hpp"
+#include "simlab/core/Geometry.hpp"
+
 #include <algorithm>
 #include <cmath>
+#include <type_traits>
 #include <vector>
 
 constexpr double DEG_TO_RAD = M_PI / 180.0;
@@ -125,9 +129,19 @@ namespace utils {
     // ✅ Normalize a vector
     template <typename T>
     inline auto normalize(const sf::Vector2<T>& v) -> sf::Vector2<T> {
-        auto len = magnitude(v);
-        return (len != 0.F) ? sf::Vector2<T>(v.x / len, v.y / len)
-                            : sf::Vector2<T>(0.F, 0.F);
+        if constexpr (simlab::math::FastMath && std::is_same_v<T, float>) {
+            // One reciprocal estimate instead of a sqrt and two divides
+            float lenSq = (v.x * v.x) + (v.y * v.y);
+            if (lenSq == 0.F) {
+                return {0.F, 0.F};
+            }
+            float inv = simlab::math::rsqrt(lenSq);
+            return {v.x * inv, v.y * inv};
+        } else {
+            auto len = magnitude(v);
+            return (len != 0.F) ? sf::Vector2<T>(v.x / len, v.y / len)
+                                : sf::Vector2<T>(0.F, 0.F);
+        }
     }
 
     // Dot product
@@ -176,7 +190,7 @@ namespace utils {
 
         // Clamp to [-1, 1] to avoid floating-point errors outside acos range
         cosTheta = std::clamp(cosTheta, -1.F, 1.F);
-        return std::acos(cosTheta);
+        return simlab::math::acos(cosTheta);
     }
 
     // Perpendicular (normal) of vector
@@ -190,8 +204,9 @@ namespace utils {
     inline auto rotate(const sf::Vector2<T>& v, float degrees)
         -> sf::Vector2<T> {
         float rad = degrees * M_PI / 180.F;
-        float cs  = std::cos(rad);
-        float sn  = std::sin(rad);
+        float cs  = 0.F;
+        float sn  = 0.F;
+        simlab::math::sincos(rad, sn, cs);
         return {(v.x * cs) - (v.y * sn), (v.x * sn) + (v.y * cs)};
     }
 
@@ -232,62 +247,35 @@ namespace utils {
         return (1 - t) * a + b * t;
     }
 
+    // One-off shapes; to draw many, write them into a shared buffer with
+    // simlab::Geometry instead
     inline auto GenerateTriangle(sf::Vector2f center, float size,
                                  sf::Color color) -> sf::VertexArray {
-        sf::VertexArray triangle(sf::PrimitiveType::Triangles);
-        sf::Vertex      v1;
-        sf::Vertex      v2;
-        sf::Vertex      v3;
-
-        v1.position = {center.x, center.y - size};
-        v2.position = {center.x - size, center.y + size};
-        v3.position = {center.x + size, center.y + size};
-
-        v1.color = v2.color = v3.color = color;
+        sf::VertexArray triangle(sf::PrimitiveType::Triangles,
+                                 simlab::Geometry::TriangleVertexCount);
+        simlab::Geometry::writeTriangle(&triangle[0], center, size, color);
         return triangle;
     }
 
     inline auto GenerateCircle(sf::Vector2f center, float radius,
                                sf::Color color) -> sf::VertexArray {
-        const int       segments = 12;
-        sf::VertexArray circle(sf::PrimitiveType::TriangleFan);
-
-        // center of the fan
-        sf::Vertex centerVertex(center, color);
-        circle.append(centerVertex);
-
-        for (int i = 0; i <= segments; i++) {
-            float        angle = i * 2.F * M_PI / segments;
-            sf::Vector2f pos{center.x + (radius * std::cos(angle)),
-                             center.y + (radius * std::sin(angle))};
-            circle.append(sf::Vertex(pos, color));
+        const auto& unit = simlab::Geometry::unitCircle();
+
+        // Center of the fan, then the rim with the first point repeated
+        sf::VertexArray circle(sf::PrimitiveType::TriangleFan,
+                               unit.size() + 1);
+        circle[0] = sf::Vertex(center, color);
+        for (std::size_t i = 0; i < unit.size(); i++) {
+            circle[i + 1] = sf::Vertex(center + (radius * unit[i]), color);
         }
-
         return circle;
     }
 
     inline auto GenerateRectangle(sf::Vector2f center, sf::Vector2f size,
                                   sf::Color color) -> sf::VertexArray {
-        // Half sizes
-        sf::VertexArray rectangle(sf::PrimitiveType::Triangles);
-        float           hw = size.x * 0.5F;
-        float           hh = size.y * 0.5F;
-
-        // 4 corners
-        sf::Vector2f topLeft(center.x - hw, center.y - hh);
-        sf::Vector2f topRight(center.x + hw, center.y - hh);
-        sf::Vector2f bottomLeft(center.x - hw, center.y + hh);
-        sf::Vector2f bottomRight(center.x + hw, center.y + hh);
-
-        // Two triangles → (topLeft, bottomLeft, topRight) and (topRight,
-        // bottomLeft, bottomRight)
-        rectangle.append(sf::Vertex(topLeft, color));
-        rectangle.append(sf::Vertex(bottomLeft, color));
-        rectangle.append(sf::Vertex(topRight, color));
-
-        rectangle.append(sf::Vertex(topRight, color));
-        rectangle.append(sf::Vertex(bottomLeft, color));
-        rectangle.append(sf::Vertex(bottomRight, color));
+        sf::VertexArray rectangle(sf::PrimitiveType::Triangles,
+                                  simlab::Geometry::RectangleVertexCount);
+        simlab::Geometry::writeRectangle(&rectangle[0], center, size, color);
         return rectangle;
     }
 
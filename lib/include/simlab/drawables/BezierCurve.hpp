@@ -1,4 +1,4 @@
-
+#pragma once
 #include <SFML/Graphics.hpp>
 
 #include "simlab/core/utils.hpp"
@@ -22,6 +22,13 @@ namespace Drawables {
 
         auto setStep(double step) -> void;
 
+        /**
+         * @brief Maximum distance, in curve units (pixels unless a view
+         * scales them), between the curve and its polyline in adaptive
+         * mode
+         */
+        auto setTolerance(float tolerance) -> void;
+
         void setPrimitiveType(sf::PrimitiveType type);
 
         void setCurveColor(sf::Color color);
@@ -51,10 +58,18 @@ namespace Drawables {
 
         auto getControlPoints() -> std::vector<sf::Vector2f>;
 
+        // Point at t in [0, 1]; O(n), no allocation
+        [[nodiscard]] auto evaluate(float t) const -> sf::Vector2f;
+
         auto enableDotLines(bool enabled) -> void;
         auto enableControlPoints(bool enabled) -> void;
         auto enableLines(bool enabled) -> void;
 
+        // Subdivide to setTolerance() instead of sampling every setStep()
+        auto enableAdaptive(bool enabled) -> void;
+
+        [[nodiscard]] auto getCurveVertexCount() const -> std::size_t;
+
       private:
 
         static auto createControlPoint(const sf::Vector2f& pos, sf::Color color,
@@ -63,10 +78,10 @@ namespace Drawables {
         auto createControlText(const std::string& str, sf::Vector2f pos)
             -> sf::Text;
         auto updateCurve() -> void;
-
-        static auto getCurvePoints(std::vector<sf::Vector2f>& pointArray,
-                                   float t, sf::VertexArray& lines)
-            -> std::vector<sf::Vector2f>;
+        auto updateUniform() -> void;
+        auto updateWeights() -> void;
+        auto updateAdaptive() -> void;
+        auto updateLines() -> void;
 
         sf::VertexArray              curve;
         sf::VertexArray              dotlines;
@@ -76,9 +91,24 @@ namespace Drawables {
         std::vector<sf::Text>        texts;
         sf::Font                     font;
 
+        // Bernstein weight of each control point at each curve sample,
+        // row-major; depends only on step and point count, so moving a
+        // point costs one weighted sum per sample
+        std::vector<float> weights;
+        std::size_t        weightsPointCount = 0;
+        double             weightsStep       = 0.0;
+
+        // de Casteljau scratch for the construction lines
+        std::vector<sf::Vector2f> construction;
+
+        // Control polygons pending in adaptive mode, one per depth, plus
+        // one split scratch polygon
+        std::vector<sf::Vector2f> subdivision;
+
         std::string filename = "assets/Fonts/DancingScript-Regular.ttf";
 
         double    step               = 0.05;
+        float     tolerance          = 0.25F;
         float     controlPointRadius = 8.F;
         sf::Color controlPointColor  = sf::Color::White;
         sf::Color curveColor         = sf::Color::Blue;
@@ -87,6 +117,7 @@ namespace Drawables {
         bool showDotLines_      = false;
         bool showControlPoints_ = true;
         bool showLines_         = false;
+        bool adaptive_          = false;
     };
 
 }  // namespace Drawables
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+
+#include <array>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace Drawables {
+
+    /**
+     * @brief Piecewise cubic curve with local control
+     * Each segment is a cubic over four consecutive control points, so
+     * moving one point re-tessellates at most four segments, in place,
+     * however long the path. Every segment owns the same number of
+     * vertices, which fixes where it lives in the vertex array. Control
+     * points are drawn as one quad buffer rather than a shape each.
+     */
+    class SplineCurve : public sf::Drawable {
+      public:
+
+        enum class Type {
+            CatmullRom,  // Through every point but the first and last
+            BSpline,     // C2 smooth, pulled towards the points
+            Bezier       // Cubic pieces sharing every third point
+        };
+
+        explicit SplineCurve(std::vector<sf::Vector2f> controlPoints = {},
+                             Type                      type = Type::CatmullRom,
+                             std::size_t               segmentSamples = 16);
+
+        void setControlPoint(std::size_t index, sf::Vector2f point);
+
+        void setControlPoints(std::vector<sf::Vector2f> points);
+
+        void append(sf::Vector2f point);
+
+        void clear();
+
+        void setType(Type type);
+
+        void setSegmentSamples(std::size_t samples);
+
+        void setCurveColor(sf::Color color);
+
+        void setControlPointColor(sf::Color color);
+
+        void setControlPointRadius(float radius);
+
+        void enableControlPoints(bool enabled);
+
+        void enableControlPolygon(bool enabled);
+
+        auto operator[](std::size_t index) const -> const sf::Vector2f&;
+
+        [[nodiscard]] auto getControlPointCount() const -> std::size_t;
+
+        [[nodiscard]] auto getSegmentCount() const -> std::size_t;
+
+        [[nodiscard]] auto getCurveVertexCount() const -> std::size_t;
+
+        void handleEvents(const sf::Event& event, sf::RenderWindow& window);
+
+        void draw(sf::RenderTarget& target,
+                  sf::RenderStates  states) const override;
+
+      private:
+
+        [[nodiscard]] auto stride() const -> std::size_t;
+
+        // [first, last) of the segments that use control point index
+        [[nodiscard]] auto affectedSegments(std::size_t index) const
+            -> std::pair<std::size_t, std::size_t>;
+
+        void updateWeights();
+        void rebuild();
+        void tessellate(std::size_t first, std::size_t last);
+        void writeHandle(std::size_t index);
+
+        std::vector<sf::Vector2f> controlPoints;
+        sf::VertexArray           curve;
+        sf::VertexArray           polygon;
+        sf::VertexArray           handles;
+
+        // Basis weights of a segment's four points at each sample t,
+        // segmentSamples + 1 rows so the last row is t = 1
+        std::vector<std::array<float, 4>> weights;
+
+        Type        type;
+        std::size_t segmentSamples;
+        sf::Color   curveColor         = sf::Color::Blue;
+        sf::Color   controlPointColor  = sf::Color::White;
+        float       controlPointRadius = 6.F;
+        int         draggingIndex      = -1;
+
+        bool showControlPoints_  = true;
+        bool showControlPolygon_ = false;
+    };
+
+}  // namespace Drawables
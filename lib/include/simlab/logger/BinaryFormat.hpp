@@ -0,0 +1,141 @@
+#pragma once
+
+#include <fmt/format.h>
+
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+
+/**
+ * Argument packing for binary log records and the on-disk layout shared
+ * by the writer thread and the log_decode tool.
+ *
+ * A binary record carries a format-site id and its arguments as raw
+ * bytes: trivially copyable values are copied as-is, strings as a 16-bit
+ * length followed by the characters. A binary log file starts with
+ * FileMagic followed by entries:
+ *   'S' u32 id, u32 line, str format, str file, str signature
+ *   'R' u32 id, u8 level, i64 timestamp ns, str payload
+ * where str is a u16 length plus bytes. Id 0 marks a preformatted text
+ * record. Each site is written once, before its first record. The
+ * signature lists one type code per argument ("i4", "u8", "f8", "b1",
+ * "c1", "s", "p8", or "x<size>" for other trivially copyable types) so
+ * the offline decoder can rebuild the arguments without the types.
+ */
+namespace Logger::Binary {
+
+    inline constexpr std::string_view FileMagic = "SIMLOG1\n";
+
+    enum class EntryTag : std::uint8_t { Site = 'S', Record = 'R' };
+
+    using DecodeFn = void (*)(std::string_view format, const char* data,
+                              std::size_t size, fmt::memory_buffer& out);
+
+    template <typename T>
+    inline constexpr bool IsString =
+        std::is_same_v<std::decay_t<T>, const char*> ||
+        std::is_same_v<std::decay_t<T>, char*> ||
+        std::is_same_v<std::decay_t<T>, std::string> ||
+        std::is_same_v<std::decay_t<T>, std::string_view>;
+
+    // What a packed argument decodes back into
+    template <typename T>
+    using Stored = std::conditional_t<IsString<T>, std::string_view,
+                                      std::remove_cv_t<std::decay_t<T>>>;
+
+    template <typename T>
+    auto encodedSize(const T& value) -> std::size_t {
+        if constexpr (IsString<T>) {
+            return sizeof(std::uint16_t) + std::string_view(value).size();
+        } else {
+            static_assert(std::is_trivially_copyable_v<T>,
+                          "Binary log arguments must be trivially copyable "
+                          "or strings");
+            return sizeof(T);
+        }
+    }
+
+    template <typename T>
+    void encode(char*& out, const T& value) {
+        if constexpr (IsString<T>) {
+            std::string_view text(value);
+            auto length = static_cast<std::uint16_t>(text.size());
+            std::memcpy(out, &length, sizeof(length));
+            std::memcpy(out + sizeof(length), text.data(), length);
+            out += sizeof(length) + length;
+        } else {
+            std::memcpy(out, &value, sizeof(T));
+            out += sizeof(T);
+        }
+    }
+
+    // Strings point into the record, so the record must outlive them
+    template <typename T>
+    auto decode(const char*& in) -> Stored<T> {
+        if constexpr (IsString<T>) {
+            std::uint16_t length = 0;
+            std::memcpy(&length, in, sizeof(length));
+            std::string_view text(in + sizeof(length), length);
+            in += sizeof(length) + length;
+            return text;
+        } else {
+            Stored<T> value;
+            std::memcpy(&value, in, sizeof(value));
+            in += sizeof(value);
+            return value;
+        }
+    }
+
+    template <typename T>
+    auto typeCode() -> std::string {
+        using U = std::remove_cv_t<std::decay_t<T>>;
+        if constexpr (IsString<T>) {
+            return "s";
+        } else if constexpr (std::is_same_v<U, bool>) {
+            return "b1";
+        } else if constexpr (std::is_same_v<U, char>) {
+            return "c1";
+        } else if constexpr (std::is_integral_v<U> || std::is_enum_v<U>) {
+            bool isSigned = false;
+            if constexpr (std::is_enum_v<U>) {
+                isSigned = std::is_signed_v<std::underlying_type_t<U>>;
+            } else {
+                isSigned = std::is_signed_v<U>;
+            }
+            return fmt::format("{}{}", isSigned ? 'i' : 'u', sizeof(U));
+        } else if constexpr (std::is_floating_point_v<U>) {
+            return fmt::format("f{}", sizeof(U));
+        } else if constexpr (std::is_pointer_v<U>) {
+            return fmt::format("p{}", sizeof(U));
+        } else {
+            return fmt::format("x{}", sizeof(U));
+        }
+    }
+
+    template <typename... Args>
+    auto signature() -> std::string {
+        std::string codes;
+        ((codes += (codes.empty() ? "" : ","), codes += typeCode<Args>()),
+         ...);
+        return codes;
+    }
+
+    // Rebuild the arguments and format them; instantiated per call site
+    template <typename... Args>
+    void decodeArgs(std::string_view format, const char* data,
+                    std::size_t /*size*/, fmt::memory_buffer& out) {
+        // Braced initialisation decodes left to right
+        std::tuple<Stored<Args>...> values{decode<Args>(data)...};
+        std::apply(
+            [&](const auto&... unpacked) {
+                fmt::vformat_to(std::back_inserter(out), format,
+                                fmt::make_format_args(unpacked...));
+            },
+            values);
+    }
+
+}  // namespace Logger::Binary
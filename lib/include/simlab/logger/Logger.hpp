@@ -7,19 +7,140 @@
 #include <fmt/format.h>
 #include <fmt/ranges.h>
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <chrono>
+#include <condition_variable>
+#include <cstdint>
 #include <fstream>
 #include <iostream>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
+
+#include "simlab/logger/BinaryFormat.hpp"
+
+// Calls below this level compile away: 0 DEBUG, 1 INFO, 2 WARN, 3 ERROR,
+// 4 FATAL. Set through the SIMLAB_LOG_LEVEL CMake cache variable
+#ifndef SIMLAB_LOG_LEVEL
+#define SIMLAB_LOG_LEVEL 0
+#endif
 
 namespace Logger {
 
     enum class LogLevel : uint8_t { DEBUG, INFO, WARN, ERROR, FATAL };
 
+    inline constexpr auto CompileTimeLevel =
+        static_cast<LogLevel>(SIMLAB_LOG_LEVEL);
+
+    // One binary log call site; see SIMLAB_BINLOG_* below
+    struct FormatSite {
+        const char*                format;
+        const char*                file;
+        int                        line;
+        std::atomic<std::uint32_t> id{0};  // 0 until first use
+    };
+
+    /**
+     * @brief Per-call-site state for the SIMLAB_LOG_EVERY_N/_FIRST_N/
+     * _EVERY_MS macros
+     * Each gate returns true when the call should log and then stores how
+     * many calls it held back since the last one that got through
+     */
+    struct RateLimit {
+        std::atomic<std::uint64_t> calls{0};
+        std::atomic<std::uint64_t> suppressed{0};
+        std::atomic<std::int64_t>  nextNs{0};  // steady_clock, interval gate
+
+        // Every window of n calls lets exactly one through; n == 0 never
+        // does, like firstN(0)
+        auto everyN(std::uint64_t n, std::uint64_t& skipped) -> bool {
+            if (n == 0) {
+                return false;
+            }
+            std::uint64_t call = calls.fetch_add(1, std::memory_order_relaxed);
+            if (call % n != 0) {
+                return false;
+            }
+            skipped = call == 0 ? 0 : n - 1;
+            return true;
+        }
+
+        // Nothing passes after the first n, so the count is never reported
+        auto firstN(std::uint64_t n, std::uint64_t& skipped) -> bool {
+            if (calls.load(std::memory_order_relaxed) >= n ||
+                calls.fetch_add(1, std::memory_order_relaxed) >= n) {
+                suppressed.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            skipped = 0;
+            return true;
+        }
+
+        auto atMostEvery(std::chrono::nanoseconds interval,
+                         std::uint64_t&           skipped) -> bool {
+            std::int64_t now =
+                std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now().time_since_epoch())
+                    .count();
+            std::int64_t next = nextNs.load(std::memory_order_relaxed);
+            // Only one of several racing threads moves the deadline
+            if (now < next ||
+                !nextNs.compare_exchange_strong(next, now + interval.count(),
+                                                std::memory_order_relaxed)) {
+                suppressed.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            skipped = suppressed.exchange(0, std::memory_order_relaxed);
+            return true;
+        }
+    };
+
+    // When the background writer pushes buffered lines out to the OS
+    enum class FlushPolicy : uint8_t {
+        EveryRecord,  // After each line; slowest, nothing lost on a crash
+        EveryBatch,   // After each drained batch
+        Interval      // At most once per flush interval
+    };
+
+    // What a log call does when the ring is full
+    enum class OverflowPolicy : uint8_t {
+        Drop,  // Count the record as dropped and return at once
+        Block  // Spin until the writer frees a slot
+    };
+
+    /**
+     * @brief Asynchronous logger
+     * Log calls format on the calling thread straight into a slot of a
+     * bounded lock-free multi-producer ring and return; a background thread
+     * drains the ring and writes console and file output in batches.
+     * Records longer than MaxMessage are truncated. ERROR and FATAL wake
+     * the writer and are always flushed.
+     *
+     * Binary records (logBinary, SIMLAB_BINLOG_*) skip formatting on the
+     * calling thread entirely: they store the call site's id and the raw
+     * argument bytes, and the writer formats them. With setBinaryLogFile()
+     * the writer also stores them unformatted for the log_decode tool.
+     */
     class Logger {
       public:
 
-        explicit Logger(std::ofstream logFile) : logFile_(std::move(logFile)) {}
+        static constexpr std::size_t RingCapacity = 8192;  // Power of two
+        static constexpr std::size_t RecordSize   = 256;
+        static constexpr std::size_t MaxMessage   = RecordSize - 24;
+
+        struct alignas(64) Record {
+            std::atomic<std::size_t>     sequence;
+            std::int64_t                 timestamp;  // system_clock ns
+            LogLevel                     level;
+            std::uint16_t                length;
+            std::uint32_t                formatId;  // 0 for text records
+            std::array<char, MaxMessage> text;      // Text or packed args
+        };
+
+        explicit Logger(std::ofstream logFile);
 
         Logger(Logger&&)                    = delete;
         auto operator=(Logger&&) -> Logger& = delete;
@@ -34,79 +155,181 @@ namespace Logger {
 
         template <typename... Args>
         void debug(fmt::format_string<Args...> fmt, Args&&... args) {
-            log(LogLevel::DEBUG, fmt, std::forward<Args>(args)...);
+            if constexpr (LogLevel::DEBUG >= CompileTimeLevel) {
+                log(LogLevel::DEBUG, 0, fmt, std::forward<Args>(args)...);
+            }
         }
 
         template <typename... Args>
         void info(fmt::format_string<Args...> fmt, Args&&... args) {
-            log(LogLevel::INFO, fmt, std::forward<Args>(args)...);
+            if constexpr (LogLevel::INFO >= CompileTimeLevel) {
+                log(LogLevel::INFO, 0, fmt, std::forward<Args>(args)...);
+            }
         }
 
         template <typename... Args>
         void warn(fmt::format_string<Args...> fmt, Args&&... args) {
-            log(LogLevel::WARN, fmt, std::forward<Args>(args)...);
+            if constexpr (LogLevel::WARN >= CompileTimeLevel) {
+                log(LogLevel::WARN, 0, fmt, std::forward<Args>(args)...);
+            }
         }
 
         template <typename... Args>
         void error(fmt::format_string<Args...> fmt, Args&&... args) {
-            log(LogLevel::ERROR, fmt, std::forward<Args>(args)...);
+            if constexpr (LogLevel::ERROR >= CompileTimeLevel) {
+                log(LogLevel::ERROR, 0, fmt, std::forward<Args>(args)...);
+            }
         }
 
         template <typename... Args>
         void fatal(fmt::format_string<Args...> fmt, Args&&... args) {
-            log(LogLevel::FATAL, fmt, std::forward<Args>(args)...);
+            if constexpr (LogLevel::FATAL >= CompileTimeLevel) {
+                log(LogLevel::FATAL, 0, fmt, std::forward<Args>(args)...);
+            }
+        }
+
+        /**
+         * @brief Log a call that got past a RateLimit
+         * A non-zero suppressed count is appended as " [N suppressed]"
+         */
+        template <typename... Args>
+        void logSampled(LogLevel level, std::uint64_t suppressed,
+                        fmt::format_string<Args...> fmt, Args&&... args) {
+            log(level, suppressed, fmt, std::forward<Args>(args)...);
         }
 
-        void setLogFile(const std::string& filename) {
-            if (logFile_.is_open()) {
-                logFile_.close();
+        /**
+         * @brief Queue a record without formatting it
+         * Arguments must be trivially copyable or strings; the format
+         * string is checked at compile time by the SIMLAB_BINLOG_* macros,
+         * which also provide the site
+         */
+        template <typename... Args>
+        void logBinary(LogLevel level, FormatSite& site, const Args&... args) {
+            if (level < currentLevel_.load(std::memory_order_relaxed)) {
+                return;
+            }
+
+            std::uint32_t id = site.id.load(std::memory_order_acquire);
+            if (id == 0) {
+                id = registerSite(site, &Binary::decodeArgs<Args...>,
+                                  Binary::signature<Args...>());
+            }
+
+            std::size_t size = (std::size_t{0} + ... +
+                                Binary::encodedSize(args));
+            if (size > MaxMessage) {
+                dropped_.fetch_add(1, std::memory_order_relaxed);
+                return;  // Too large to pack
             }
-            logFile_.open(filename, std::ios::app);
+
+            std::size_t position = 0;
+            Record*     record   = claim(position);
+            if (record == nullptr) {
+                return;
+            }
+
+            record->timestamp =
+                std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::system_clock::now().time_since_epoch())
+                    .count();
+            record->level    = level;
+            record->formatId = id;
+            record->length   = static_cast<std::uint16_t>(size);
+
+            char* out = record->text.data();
+            (Binary::encode(out, args), ...);
+
+            publish(record, position, level >= LogLevel::ERROR);
+        }
+
+        void setLogFile(const std::string& filename);
+
+        // Also store every record unformatted; read back with log_decode
+        void setBinaryLogFile(const std::string& filename);
+
+        auto isEnabled(LogLevel level) const -> bool {
+            return level >= currentLevel_.load(std::memory_order_relaxed);
         }
 
         void setLevel(LogLevel level) {
-            currentLevel_ = level;
+            currentLevel_.store(level, std::memory_order_relaxed);
         }
 
-      private:
+        void setFlushPolicy(FlushPolicy               policy,
+                            std::chrono::milliseconds interval =
+                                std::chrono::milliseconds(100));
+
+        void setOverflowPolicy(OverflowPolicy policy) {
+            overflowPolicy_.store(policy, std::memory_order_relaxed);
+        }
 
-        Logger() = default;
+        // Block until everything logged so far is written and flushed
+        void flush();
 
-        ~Logger() {
-            if (logFile_.is_open()) {
-                logFile_.close();
-            }
+        // Records lost to a full ring under OverflowPolicy::Drop
+        auto getDroppedCount() const -> std::uint64_t {
+            return dropped_.load(std::memory_order_relaxed);
         }
 
+      private:
+
+        Logger();
+
+        ~Logger();
+
         template <typename... Args>
-        void log(LogLevel level, fmt::format_string<Args...> fmt,
-                 Args&&... args) {
-            if (level < currentLevel_) {
+        void log(LogLevel level, std::uint64_t suppressed,
+                 fmt::format_string<Args...> fmt, Args&&... args) {
+            if (level < currentLevel_.load(std::memory_order_relaxed)) {
+                return;
+            }
+
+            std::size_t position = 0;
+            Record*     record   = claim(position);
+            if (record == nullptr) {
                 return;
             }
 
-            auto now       = std::chrono::system_clock::now();
-            auto timestamp = std::chrono::system_clock::to_time_t(now);
+            record->timestamp =
+                std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::system_clock::now().time_since_epoch())
+                    .count();
+            record->level    = level;
+            record->formatId = 0;
+
+            auto result = fmt::format_to_n(record->text.data(), MaxMessage,
+                                           fmt, std::forward<Args>(args)...);
+            std::size_t length = std::min<std::size_t>(result.size, MaxMessage);
+            if (result.size > MaxMessage) {
+                std::fill_n(record->text.end() - 3, 3, '.');
+            } else if (suppressed != 0) {
+                auto note = fmt::format_to_n(record->text.data() + length,
+                                             MaxMessage - length,
+                                             " [{} suppressed]", suppressed);
+                length = std::min<std::size_t>(length + note.size, MaxMessage);
+            }
+            record->length = static_cast<std::uint16_t>(length);
 
-            std::string levelStr   = getLevelString(level);
-            fmt::color  levelColor = getLevelColor(level);
+            publish(record, position, level >= LogLevel::ERROR);
+        }
 
-            // Format the message
-            std::string message = fmt::format(fmt, std::forward<Args>(args)...);
+        /**
+         * Vyukov bounded queue: a slot is free for position p when its
+         * sequence equals p and readable when it equals p + 1
+         */
+        auto claim(std::size_t& position) -> Record*;
 
-            // Format the final log line
-            std::string logLine =
-                fmt::format("[{}] [{}] {}", levelStr, timestamp, message);
+        void publish(Record* record, std::size_t position, bool urgent);
 
-            // Console output with colors
-            fmt::print(fg(levelColor), "{}\n", logLine);
+        static auto registerSite(FormatSite& site, Binary::DecodeFn decode,
+                                 std::string signature) -> std::uint32_t;
 
-            // File output without colors
-            if (logFile_.is_open()) {
-                logFile_ << logLine;
-                logFile_.flush();
-            }
-        }
+        void writerLoop();
+
+        void startWriter();
+
+        void stopWriter();
 
         static auto getLevelString(LogLevel level) -> std::string {
             switch (level) {
@@ -142,8 +365,30 @@ namespace Logger {
             }
         }
 
-        LogLevel      currentLevel_ = LogLevel::DEBUG;
-        std::ofstream logFile_;
+        std::atomic<LogLevel>       currentLevel_{LogLevel::DEBUG};
+        std::atomic<OverflowPolicy> overflowPolicy_{OverflowPolicy::Drop};
+        std::atomic<std::uint64_t>  dropped_{0};
+
+        std::unique_ptr<Record[]> ring_;
+        std::atomic<std::size_t>  enqueuePos_{0};
+        std::size_t               dequeuePos_ = 0;  // Writer thread only
+
+        std::mutex                fileMutex_;
+        std::ofstream             logFile_;
+        std::ofstream             binaryFile_;
+        std::uint64_t             binaryGeneration_ = 0;
+        FlushPolicy               flushPolicy_ = FlushPolicy::Interval;
+        std::chrono::milliseconds flushInterval_{100};
+
+        // Writer wake-ups and flush() hand-shake
+        std::mutex              writerMutex_;
+        std::condition_variable writerWake_;
+        std::condition_variable flushDone_;
+        bool                    stopping_    = false;
+        bool                    urgent_      = false;
+        std::size_t             flushTarget_ = 0;
+        std::size_t             flushedUpTo_ = 0;
+        std::thread             writer_;
     };
 
     // Global logger access function
@@ -152,3 +397,93 @@ namespace Logger {
     }
 
 }  // namespace Logger
+
+/**
+ * Level-filtered logging that vanishes below SIMLAB_LOG_LEVEL, arguments
+ * included. SIMLAB_LOG_* format on the calling thread; SIMLAB_BINLOG_*
+ * only copy their arguments and leave formatting to the writer.
+ */
+#define SIMLAB_LOG_DISABLED(...) ((void)0)
+
+// The dead fmt::format call only checks the format string at compile time
+#define SIMLAB_BINLOG_IMPL(logger, level, pattern, ...)                \
+    do {                                                               \
+        if (false) {                                                   \
+            static_cast<void>(                                         \
+                fmt::format(FMT_STRING(pattern), ##__VA_ARGS__));      \
+        }                                                              \
+        static ::Logger::FormatSite simlabLogSite{pattern, __FILE__,   \
+                                                  __LINE__};           \
+        (logger).logBinary(level, simlabLogSite, ##__VA_ARGS__);       \
+    } while (false)
+
+/**
+ * Rate-limited logging for hot loops, one RateLimit per call site:
+ *   SIMLAB_LOG_EVERY_N(log, Logger::LogLevel::DEBUG, 100, "x {}", x);
+ *   SIMLAB_LOG_FIRST_N(log, Logger::LogLevel::WARN, 5, "x {}", x);
+ *   SIMLAB_LOG_EVERY_MS(log, Logger::LogLevel::DEBUG, 1000, "x {}", x);
+ * A held-back call costs one atomic update and evaluates no arguments;
+ * the next line that gets through carries the held-back count.
+ */
+#define SIMLAB_LOG_LIMITED_IMPL(logger, level, gate, limit, ...)       \
+    do {                                                               \
+        if constexpr ((level) >= ::Logger::CompileTimeLevel) {         \
+            static ::Logger::RateLimit simlabRateLimit;                \
+            std::uint64_t              simlabSuppressed = 0;           \
+            if ((logger).isEnabled(level) &&                           \
+                simlabRateLimit.gate(limit, simlabSuppressed)) {       \
+                (logger).logSampled(level, simlabSuppressed,           \
+                                    __VA_ARGS__);                      \
+            }                                                          \
+        }                                                              \
+    } while (false)
+
+#define SIMLAB_LOG_EVERY_N(logger, level, n, ...) \
+    SIMLAB_LOG_LIMITED_IMPL(logger, level, everyN, n, __VA_ARGS__)
+
+#define SIMLAB_LOG_FIRST_N(logger, level, n, ...) \
+    SIMLAB_LOG_LIMITED_IMPL(logger, level, firstN, n, __VA_ARGS__)
+
+#define SIMLAB_LOG_EVERY_MS(logger, level, ms, ...)      \
+    SIMLAB_LOG_LIMITED_IMPL(logger, level, atMostEvery, \
+                            std::chrono::milliseconds(ms), __VA_ARGS__)
+
+#if SIMLAB_LOG_LEVEL <= 0
+#define SIMLAB_LOG_DEBUG(logger, ...) (logger).debug(__VA_ARGS__)
+#define SIMLAB_BINLOG_DEBUG(logger, ...) \
+    SIMLAB_BINLOG_IMPL(logger, ::Logger::LogLevel::DEBUG, __VA_ARGS__)
+#else
+#define SIMLAB_LOG_DEBUG    SIMLAB_LOG_DISABLED
+#define SIMLAB_BINLOG_DEBUG SIMLAB_LOG_DISABLED
+#endif
+
+#if SIMLAB_LOG_LEVEL <= 1
+#define SIMLAB_LOG_INFO(logger, ...) (logger).info(__VA_ARGS__)
+#define SIMLAB_BINLOG_INFO(logger, ...) \
+    SIMLAB_BINLOG_IMPL(logger, ::Logger::LogLevel::INFO, __VA_ARGS__)
+#else
+#define SIMLAB_LOG_INFO    SIMLAB_LOG_DISABLED
+#define SIMLAB_BINLOG_INFO SIMLAB_LOG_DISABLED
+#endif
+
+#if SIMLAB_LOG_LEVEL <= 2
+#define SIMLAB_LOG_WARN(logger, ...) (logger).warn(__VA_ARGS__)
+#define SIMLAB_BINLOG_WARN(logger, ...) \
+    SIMLAB_BINLOG_IMPL(logger, ::Logger::LogLevel::WARN, __VA_ARGS__)
+#else
+#define SIMLAB_LOG_WARN    SIMLAB_LOG_DISABLED
+#define SIMLAB_BINLOG_WARN SIMLAB_LOG_DISABLED
+#endif
+
+#if SIMLAB_LOG_LEVEL <= 3
+#define SIMLAB_LOG_ERROR(logger, ...) (logger).error(__VA_ARGS__)
+#define SIMLAB_BINLOG_ERROR(logger, ...) \
+    SIMLAB_BINLOG_IMPL(logger, ::Logger::LogLevel::ERROR, __VA_ARGS__)
+#else
+#define SIMLAB_LOG_ERROR    SIMLAB_LOG_DISABLED
+#define SIMLAB_BINLOG_ERROR SIMLAB_LOG_DISABLED
+#endif
+
+#define SIMLAB_LOG_FATAL(logger, ...) (logger).fatal(__VA_ARGS__)
+#define SIMLAB_BINLOG_FATAL(logger, ...) \
+    SIMLAB_BINLOG_IMPL(logger, ::Logger::LogLevel::FATAL, __VA_ARGS__)
@@ -1,10 +1,30 @@
 #pragma once
 
 // Core Headers
+#include "simlab/core/AllocationTracker.hpp"
+#include "simlab/core/Automata.hpp"
+#include "simlab/core/BatchMath.hpp"
 #include "simlab/core/Benchmark.hpp"
+#include "simlab/core/BenchmarkRunner.hpp"
 #include "simlab/core/Collision.hpp"
+#include "simlab/core/ContactGraph.hpp"
+#include "simlab/core/FastMath.hpp"
 #include "simlab/core/Game.hpp"
+#include "simlab/core/Geometry.hpp"
+#include "simlab/core/Histogram.hpp"
+#include "simlab/core/Mat3.hpp"
+#include "simlab/core/NarrowPhase.hpp"
+#include "simlab/core/Palette.hpp"
+#include "simlab/core/PerformanceOverlay.hpp"
 #include "simlab/core/PhysicsManager.hpp"
+#include "simlab/core/PolygonCollider.hpp"
+#include "simlab/core/Profiler.hpp"
+#include "simlab/core/Random.hpp"
+#include "simlab/core/SfmlInterop.hpp"
+#include "simlab/core/SignedDistanceField.hpp"
+#include "simlab/core/SleepManager.hpp"
+#include "simlab/core/ThreadPool.hpp"
+#include "simlab/core/Vec2.hpp"
 #include "simlab/core/formatter.hpp"
 #include "simlab/core/utils.hpp"
 
@@ -13,3 +33,4 @@
 
 // Drawable headers
 #include "simlab/drawables/BezierCurve.hpp"
+#include "simlab/drawables/SplineCurve.hpp"
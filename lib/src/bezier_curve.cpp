@@ -45,6 +45,7 @@ namespace {
             curve.setPrimitiveType(sf::LineStrip);
             curve.setControlPointRadius(10.0);
             curve.setStep(0.001);
+            curve.enableAdaptive(true);
             curve.enableDotLines(true);
 
             curve2.setControlPoints(controlPoints);
@@ -5,7 +5,6 @@
 #include "simlab/simlab.hpp"
 
 #include <array>
-#include <random>
 #include <unordered_map>
 
 namespace {
@@ -25,6 +24,27 @@ namespace {
         std::vector<sf::CircleShape> balls;
         std::vector<sf::Vector2f>    ballSpeeds;
 
+        // Ball-ball contacts, colored so each batch solves in parallel
+        simlab::ThreadPool               pool;
+        simlab::ContactGraph             contactGraph;
+        std::vector<simlab::ContactPair> contactPairs;
+
+        // Broadphase candidates go through the type-dispatched narrow phase
+        simlab::ColliderSet              colliders;
+        simlab::NarrowPhase              narrowPhase;
+        std::vector<simlab::ContactPair> candidatePairs;
+        std::vector<simlab::Contact>     contacts;
+
+        // Resting balls stop integrating until something touches them. The
+        // balls' velocities are copied in and out of the headless manager
+        simlab::SleepManager       sleepManager;
+        std::vector<simlab::Vec2f> sleepVelocities;
+
+        // Static obstacles, collided through a distance field
+        sf::Vector2f                    windowSize;
+        std::vector<sf::RectangleShape> obstacles;
+        simlab::SignedDistanceField     staticWorld;
+
         static auto createContextSettings() -> sf::ContextSettings {
             sf::ContextSettings settings;
             settings.sRgbCapable       = true;
@@ -43,6 +63,7 @@ namespace {
               balls(nBalls),
               ballSpeeds(nBalls) {
             setFramerateLimit(120);
+            sleepManager.resize(balls.size());
             enablePhysicsEngine();
             // m_physicsManager->setFixedTimeStep(false);
             // m_window.setVerticalSyncEnabled(true);
@@ -50,6 +71,9 @@ namespace {
             renderTex.create(window.getSize().x, window.getSize().y);
             sprite.setTexture(renderTex.getTexture());
 
+            windowSize = sf::Vector2f(window.getSize());
+            createObstacles();
+
             ball.setFillColor(sf::Color::Black);
             ball.setOutlineColor(sf::Color::Green);
             ball.setOutlineThickness(3);
@@ -59,35 +83,26 @@ namespace {
             log.info("Circle Origin: {}\n", ball.getOrigin());
             log.info("Circle Position: {}\n", ball.getPosition());
 
-            std::random_device rd;
-            std::mt19937       gen(rd());
+            auto& random = simlab::Random::threadLocal();
 
             // Radius range
             float minRadius = 20.F;
             float maxRadius = 50.F;
 
-            // Distribution for radius
-            std::uniform_real_distribution<float> distRadius(minRadius,
-                                                             maxRadius);
-            std::uniform_int_distribution<int>    distColor(0, 255);
             for (auto& ball : balls) {
-                float radius = distRadius(gen);
+                float radius = random.uniform(minRadius, maxRadius);
                 ball.setRadius(radius);
                 ball.setOrigin(ball.getRadius(), ball.getRadius());
 
                 // Random position within window bounds (account for radius)
-                std::uniform_real_distribution<float> distX(
-                    radius, WindowWidth - radius);
-                std::uniform_real_distribution<float> distY(
-                    radius, WindowHeight - radius);
-
-                float x = distX(gen);
-                float y = distY(gen);
+                float x = random.uniform(radius, WindowWidth - radius);
+                float y = random.uniform(radius, WindowHeight - radius);
                 ball.setPosition(x, y);
 
                 // Random fill and outline colors
-                sf::Color fillColor(distColor(gen), distColor(gen),
-                                    distColor(gen));
+                sf::Color fillColor(random.uniformInt(0, 255),
+                                    random.uniformInt(0, 255),
+                                    random.uniformInt(0, 255));
                 ball.setFillColor(fillColor);
                 // ball.setOutlineColor(outlineColor);
 
@@ -97,11 +112,13 @@ namespace {
             float minSpeed = -200.F;
             float maxSpeed = 200.F;
 
-            // Distribution for speed
-            std::uniform_real_distribution<float> distSpeed(minSpeed, maxSpeed);
-
             for (auto& speed : ballSpeeds) {
-                speed = {distSpeed(gen), distSpeed(gen)};
+                speed = {random.uniform(minSpeed, maxSpeed),
+                         random.uniform(minSpeed, maxSpeed)};
+            }
+
+            for (const auto& ball : balls) {
+                colliders.addCircle(ball);
             }
 
             font.loadFromFile("assets/Fonts/DancingScript-Regular.ttf");
@@ -120,6 +137,27 @@ namespace {
 
       private:
 
+        void createObstacles() {
+            sf::Vector2f center = windowSize / 2.F;
+
+            sf::RectangleShape bar({windowSize.x / 4.F, 30.F});
+            bar.setOrigin(bar.getSize() / 2.F);
+            bar.setFillColor(sf::Color(90, 90, 90));
+            bar.setPosition(center.x - (windowSize.x / 5.F), center.y);
+            bar.setRotation(30.F);
+            obstacles.push_back(bar);
+
+            bar.setPosition(center.x + (windowSize.x / 5.F), center.y);
+            bar.setRotation(-30.F);
+            obstacles.push_back(bar);
+
+            staticWorld.reset({}, simlab::fromSf(windowSize), 8.F);
+            for (const auto& obstacle : obstacles) {
+                simlab::addShape(staticWorld, obstacle);
+            }
+            staticWorld.build(pool);
+        }
+
         void Update(float dt) override {
             int                counter  = 0;
             static const float cellSize = ball.getRadius() * 2.F;
@@ -133,19 +171,22 @@ namespace {
 
             // 2. Predict next position
             predictNextPosition(ball, ballSpeed, dt);
-            windowCollision(window, ball, ballSpeed);
+            staticCollision(ball, ballSpeed);
 
             for (int i = 0; i < nBalls; i++) {
                 auto& ball  = balls[i];
                 auto& speed = ballSpeeds[i];
 
-                predictNextPosition(ball, speed, dt);
-                windowCollision(window, ball, speed);
+                if (sleepManager.isAwake(i)) {
+                    predictNextPosition(ball, speed, dt);
+                    staticCollision(ball, speed);
+                }
                 auto cell = utils::toVector2i(ball.getPosition() / cellSize);
                 gridBucket[cell].push_back(i);
 
                 simlab::Collision::elasticCollisionAdvanced(
                     this->ball, balls[i], ballSpeed, ballSpeeds[i]);
+                colliders.update(static_cast<std::uint32_t>(i));
             }
 
             // Offsets for 8 neighbors + current cell
@@ -154,30 +195,61 @@ namespace {
                 sf::Vector2i(0, 1),  sf::Vector2i(0, -1), sf::Vector2i(1, 1),
                 sf::Vector2i(-1, 1), sf::Vector2i(1, -1), sf::Vector2i(-1, -1)};
 
+            candidatePairs.clear();
             for (auto& [cell, ballIdx] : gridBucket) {
                 for (int idx : ballIdx) {
-                    auto& ball1 = balls[idx];
-
                     // Neighbor cells
                     for (auto offset : neighborOffsets) {
                         sf::Vector2i neighbor = cell + offset;
-                        if (gridBucket.count(neighbor) == 0) {
+                        auto         it       = gridBucket.find(neighbor);
+                        if (it == gridBucket.end()) {
                             continue;
                         }
 
-                        for (auto& j : gridBucket[neighbor]) {
-                            auto& ball2 = balls[j];
-                            if (&ball1 == &ball2) {
+                        // Each pair once, from its lower index; pairs of
+                        // sleeping balls skip the narrow phase entirely
+                        for (int j : it->second) {
+                            if (j <= idx ||
+                                !sleepManager.isPairActive(idx, j)) {
                                 continue;
                             }
-                            counter++;
-                            simlab::Collision::elasticCollisionAdvanced(
-                                ball1, ball2, ballSpeeds[idx], ballSpeeds[j]);
+                            candidatePairs.push_back(
+                                {static_cast<std::uint32_t>(idx),
+                                 static_cast<std::uint32_t>(j)});
                         }
                     }
                 }
             }
-            log.debug("Collisions: {}", counter);
+
+            contacts.clear();
+            narrowPhase.run(colliders, candidatePairs, contacts);
+
+            contactPairs.clear();
+            for (const auto& contact : contacts) {
+                contactPairs.push_back(contact.pair);
+            }
+            counter = static_cast<int>(contactPairs.size());
+
+            contactGraph.build(contactPairs, balls.size());
+            // Re-test each pair from current positions: earlier contacts in
+            // the solve have already moved shared bodies
+            contactGraph.solve(
+                pool, [this](const simlab::ContactPair& pair) -> void {
+                    simlab::Collision::elasticCollisionAdvanced(
+                        balls[pair.bodyA], balls[pair.bodyB],
+                        ballSpeeds[pair.bodyA], ballSpeeds[pair.bodyB]);
+                });
+            sleepVelocities.resize(ballSpeeds.size());
+            for (std::size_t i = 0; i < ballSpeeds.size(); i++) {
+                sleepVelocities[i] = simlab::fromSf(ballSpeeds[i]);
+            }
+            sleepManager.update(contactPairs, sleepVelocities, dt);
+            for (std::size_t i = 0; i < ballSpeeds.size(); i++) {
+                ballSpeeds[i] = simlab::toSf(sleepVelocities[i]);
+            }
+            overlay.setCounter("Collisions", counter);
+            SIMLAB_LOG_EVERY_MS(log, Logger::LogLevel::DEBUG, 1000,
+                                "Collisions: {}", counter);
             ballSpeed += ballDir * acceleration / 2.F * dt;
         }
 
@@ -189,24 +261,32 @@ namespace {
             circle.setPosition(predictedPos);
         }
 
-        static void windowCollision(sf::RenderWindow& window,
-                                    sf::CircleShape&  circle,
-                                    sf::Vector2f&     velocity) {
-            // Handle window collision & correct position
-            auto windowCollision =
-                simlab::Collision::windowCollision(circle, window);
-            if (windowCollision.collided) {
-                velocity = utils::reflect(velocity, windowCollision.normal);
-                // Correct position to move ball out of the wall
-                auto predictedPos =
-                    circle.getPosition() +
-                    windowCollision.normal * windowCollision.penetration;
+        void staticCollision(sf::CircleShape& circle, sf::Vector2f& velocity) {
+            resolveStaticCollision(
+                circle, velocity,
+                simlab::Collision::windowCollision(circle, windowSize));
+            resolveStaticCollision(
+                circle, velocity,
+                simlab::Collision::sdfCollision(circle, staticWorld));
+        }
+
+        static void resolveStaticCollision(
+            sf::CircleShape& circle, sf::Vector2f& velocity,
+            const simlab::CollisionInfo& collision) {
+            if (collision.collided) {
+                velocity = utils::reflect(velocity, collision.normal);
+                // Correct position to move ball out of the obstacle
+                auto predictedPos = circle.getPosition() +
+                                    collision.normal * collision.penetration;
                 circle.setPosition(predictedPos);
             }
         }
 
         void Draw(sf::RenderWindow& win) override {
             renderTex.clear(sf::Color::Black);
+            for (const auto& obstacle : obstacles) {
+                renderTex.draw(obstacle);
+            }
             renderTex.draw(ball);
             for (auto& ball : balls) {
                 renderTex.draw(ball);
@@ -1,6 +1,5 @@
 #include "simlab/simlab.hpp"
 
-#include <random>
 
 namespace {
 
@@ -15,19 +14,18 @@ namespace {
 
         std::vector<sf::RectangleShape> squares;
         std::vector<bool>               states;
+        std::vector<bool>               newStates;
 
         sf::RenderTexture renderTex;
         sf::Sprite        sprite;
 
-        std::mt19937 generator;
-        int          currRow = 1;
-        sf::View     view;
+        int      currRow = 1;
+        sf::View view;
 
       public:
 
         CellularAutomata()
-            : simlab::Game("Cellular Automata", sf::Style::Fullscreen),
-              generator(std::random_device{}()) {
+            : simlab::Game("Cellular Automata", sf::Style::Fullscreen) {
             setFramerateLimit(60);
             renderTex.create(window.getSize().x, window.getSize().y);
             sprite.setTexture(renderTex.getTexture());
@@ -55,10 +53,10 @@ namespace {
         void init() {
             renderTex.clear(sf::Color::Black);
             currRow = 1;
-            std::bernoulli_distribution dist(probabilityOfOne);
+            auto& random = simlab::Random::threadLocal();
 
             for (int i = 0; i < gridWidth; i++) {
-                auto state = dist(generator);
+                bool state = random.chance(probabilityOfOne);
                 states[i]  = state;
                 squares[i].setSize({cellSize, cellSize});
                 squares[i].setPosition({i * cellSize, 00});
@@ -70,11 +68,6 @@ namespace {
             // squares[mid].setFillColor(getColor(states[mid]));
         }
 
-        static auto calcNextState(bool a, bool b, bool c) -> bool {
-            uint8_t pattern = (b << 1) | (a << 2) | c;
-            return ((RULE >> pattern) & 1) != 0;  // LSB = pattern 000
-        }
-
         static auto getColor(bool state) -> sf::Color {
             return state ? sf::Color::White : sf::Color::Black;
         }
@@ -83,18 +76,14 @@ namespace {
             if (currRow >= gridHeight) {
                 return;
             }
-            std::vector<bool> newStates(gridWidth);
-            for (int i = 0; i < gridWidth; i++) {
-                auto left  = states[(i - 1 + gridWidth) % gridWidth];
-                auto mid   = states[i];
-                auto right = states[(i + 1 + gridWidth) % gridWidth];
-
-                newStates[i] = calcNextState(left, mid, right);
+            simlab::Automata::elementaryStep(static_cast<uint8_t>(RULE), states,
+                                             newStates);
+            states.swap(newStates);
 
+            for (int i = 0; i < gridWidth; i++) {
                 squares[i].setPosition({i * cellSize, currRow * cellSize});
-                squares[i].setFillColor(getColor(newStates[i]));
+                squares[i].setFillColor(getColor(states[i]));
             }
-            states = std::move(newStates);
             currRow++;
         }
 
@@ -108,10 +97,9 @@ namespace {
         }
 
         void handleEvents(sf::Event& event) override {
-            static std::uniform_int_distribution<int> distRule(0, 255);
             if (event.type == sf::Event::MouseButtonPressed &&
                 event.mouseButton.button == sf::Mouse::Right) {
-                RULE = distRule(generator);
+                RULE = simlab::Random::threadLocal().uniformInt(0, 255);
                 log.info("RULE: {}", RULE);
                 init();
             }
@@ -1,6 +1,5 @@
 #include "simlab/simlab.hpp"
 
-#include <random>
 #include <unordered_set>
 
 namespace {
@@ -19,7 +18,12 @@ namespace {
         sf::Color         color = sf::Color(150, 150, 150, 250);
 
         std::vector<std::vector<bool>> grid;
+        std::vector<std::vector<bool>> nextGrid;
         std::vector<sf::Vector2i>      dragPos;
+        simlab::Palette                palette = simlab::Palette::hsv();
+        std::vector<sf::Color>         cellColors;    // Radial hue per cell
+        std::vector<sf::Vertex>        cellVertices;  // Drawn in one call
+        simlab::LifeRule               rule = simlab::LifeRule::conway();
 
         static auto createContextSettings() -> sf::ContextSettings {
             sf::ContextSettings settings;
@@ -44,6 +48,7 @@ namespace {
 
             gridWidth  = window.getSize().x / static_cast<int>(cellSize);
             gridHeight = window.getSize().y / static_cast<int>(cellSize);
+            buildCellColors();
 
             auto color = this->color;
             color.a    = 100;
@@ -58,82 +63,83 @@ namespace {
             renderTex.clear(sf::Color::Transparent);
             grid.clear();
 
-            std::bernoulli_distribution dist(probabilityOfOne);
-            std::mt19937                generator(std::random_device{}());
-
             grid.resize(gridHeight);
             for (int i = 0; i < gridHeight; i++) {
                 grid[i].resize(gridWidth);
                 for (int j = 0; j < gridWidth; j++) {
-                    // grid[i][j] = dist(generator);
                     if (grid[i][j]) {
                         drawRectangle(i, j);
                     }
                 }
             }
+            flushCells();
         }
 
-        auto calcNextState(int row, int col) -> bool {
-            bool state = grid[row][col];
-            int  sum   = 0;
-
-            for (int di = -1; di <= 1; di++) {
-                for (int dj = -1; dj <= 1; dj++) {
-                    if (di == 0 && dj == 0) {
-                        continue;  // skip self
-                    }
+        void Update(float /*dt*/) override {
+            renderTex.clear(sf::Color::Transparent);
 
-                    int ni = (row + di + gridHeight) % gridHeight;
-                    int nj = (col + dj + gridWidth) % gridWidth;
+            simlab::Automata::lifeStep(grid, nextGrid, rule);
+            grid.swap(nextGrid);
 
-                    if (grid[ni][nj]) {
-                        sum++;
+            for (int i = 0; i < gridHeight; i++) {
+                for (int j = 0; j < gridWidth; j++) {
+                    if (grid[i][j]) {
+                        drawRectangle(i, j);
                     }
                 }
             }
-
-            return (state && (sum == 2 || sum == 3)) || (!state && sum == 3);
+            flushCells();
         }
 
-        void Update(float /*dt*/) override {
-            renderTex.clear(sf::Color::Transparent);
+        // Distance from the grid center, 1 at the middle of each edge
+        auto radialDistance(int i, int j) const -> float {
+            float cx = gridWidth / 2.F;
+            float cy = gridHeight / 2.F;
 
-            std::vector<std::vector<bool>> nextGrid(gridHeight);
+            float dx = (j - cx) / cx;
+            float dy = (i - cy) / cy;
+            return std::sqrt((dx * dx) + (dy * dy));
+        }
 
+        // The gradient only depends on the grid, so map it once
+        void buildCellColors() {
+            std::vector<float> distances(
+                static_cast<std::size_t>(gridWidth) * gridHeight);
             for (int i = 0; i < gridHeight; i++) {
-                nextGrid[i].resize(gridWidth);
                 for (int j = 0; j < gridWidth; j++) {
-                    nextGrid[i][j] = calcNextState(i, j);
-
-                    if (nextGrid[i][j]) {
-                        drawRectangle(i, j);
-                    }
+                    distances[(i * gridWidth) + j] = radialDistance(i, j);
                 }
             }
-            grid = std::move(nextGrid);
+            cellColors = palette.map(distances);
+        }
+
+        auto cellColor(int i, int j) const -> sf::Color {
+            if (i >= 0 && i < gridHeight && j >= 0 && j < gridWidth) {
+                return cellColors[(i * gridWidth) + j];
+            }
+            return palette(radialDistance(i, j));  // Dragged off the grid
         }
 
         void drawRectangle(int i, int j) {
             sf::Vector2f center((j * cellSize) + (cellSize / 2.F),
                                 (i * cellSize) + (cellSize / 2.F));
 
-            float cx = gridWidth / 2.F;
-            float cy = gridHeight / 2.F;
-
-            float dx   = (j - cx) / cx;
-            float dy   = (i - cy) / cy;
-            float dist = std::sqrt((dx * dx) + (dy * dy));
+            simlab::Geometry::appendRectangle(cellVertices, center,
+                                              {cellSize, cellSize},
+                                              cellColor(i, j));
+        }
 
-            sf::Color color = utils::HSVtoRGB(dist, 1.0F, 1.0F);
-            auto      rect =
-                utils::GenerateRectangle(center, {cellSize, cellSize}, color);
-            renderTex.draw(rect);
+        void flushCells() {
+            renderTex.draw(cellVertices.data(), cellVertices.size(),
+                           sf::Triangles);
+            cellVertices.clear();  // Keeps capacity for the next generation
         }
 
         void Draw(sf::RenderWindow& win) override {
             for (const auto& drag : dragPos) {
                 drawRectangle(drag.y, drag.x);
             }
+            flushCells();
             renderTex.display();
             win.draw(gridSprite);
             win.draw(sprite);
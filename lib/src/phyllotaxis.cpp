@@ -1,7 +1,6 @@
 #include "simlab/simlab.hpp"
 
 #include <cmath>
-#include <random>
 
 namespace {
 
@@ -12,6 +11,7 @@ namespace {
         sf::Sprite        sprite;
 
         sf::VertexArray points;
+        simlab::Palette rainbow = simlab::Palette::hsl(1.F, 0.5F);
 
         int n = 0;
         int c = 5;
@@ -38,18 +38,20 @@ namespace {
 
         void GeneratePoints(int total = 1) {
             for (int i = 0; i < total; i++) {
-                static std::uniform_int_distribution<int> distColor(0, 255);
-                std::mt19937                              generator(42);
-
                 auto theta  = n * 137.5;
                 auto radius = c * std::sqrt(n);
 
-                theta *= DEG_TO_RAD;
+                // Wrap in double first; theta grows without bound with n
+                theta = std::fmod(theta, 360.0) * DEG_TO_RAD;
+
+                float cs = 0.F;
+                float sn = 0.F;
+                simlab::math::sincos(static_cast<float>(theta), sn, cs);
 
                 sf::Vector2f pos(
-                    static_cast<float>((std::cos(theta) * radius) +
+                    static_cast<float>((cs * radius) +
                                        (window.getSize().x / 2.F)),
-                    static_cast<float>((std::sin(theta) * radius) +
+                    static_cast<float>((sn * radius) +
                                        (window.getSize().y / 2.F)));
 
                 if (pos.x < 0 || pos.x > window.getSize().x || pos.y < 0 ||
@@ -59,7 +61,7 @@ namespace {
 
                 // 🌈 smooth rainbow effect
                 float     hue   = std::fmod(n * 0.5F, 360.F);  // 0.5° per step
-                sf::Color color = utils::HSLtoRGB(hue, 1.F, 0.5F);
+                sf::Color color = rainbow(hue / 360.F);
 
                 sf::Vertex vertex(pos, color);
                 points.append(vertex);
@@ -2,7 +2,6 @@
 #include "simlab/simlab.hpp"
 
 #include <optional>
-#include <random>
 #include <unordered_map>
 
 namespace {
@@ -27,10 +26,7 @@ namespace {
         int rows, cols;
         int counter = 0;
 
-        std::mt19937 generator;
-
-        std::uniform_real_distribution<float> distAngle;
-        std::uniform_real_distribution<float> distL;
+        simlab::Random random = simlab::Random::threadLocal().split();
 
         sf::RenderTexture renderTex;
         sf::Sprite        pointSprite;
@@ -50,10 +46,7 @@ namespace {
               width(static_cast<int>(window.getSize().x)),
               height(static_cast<int>(window.getSize().y)),
               rows(std::floor(height / cellSize)),
-              cols(std::floor(width / cellSize)),
-              generator(std::random_device{}()),
-              distAngle(0.F, 2 * M_PI),
-              distL(R, 2.F * R) {
+              cols(std::floor(width / cellSize)) {
             setFramerateLimit(120);
             log.info("R: {}\n", R);
             log.info("cellSize: {}\n", cellSize);
@@ -108,10 +101,9 @@ namespace {
             point.setRadius(radius);
             point.setOrigin(point.getRadius(), point.getRadius());
 
-            std::uniform_real_distribution<float> distColor(0.F, 255.F);
-            sf::Color fillColor(distColor(generator), distColor(generator),
-
-                                distColor(generator));
+            sf::Color fillColor(random.uniformInt(0, 255),
+                                random.uniformInt(0, 255),
+                                random.uniformInt(0, 255));
             point.setFillColor(fillColor);
             point.setPosition(position);
         }
@@ -132,21 +124,21 @@ namespace {
                 if (activePoints.empty()) {
                     return;
                 }
-                std::uniform_int_distribution<int> dist(
-                    0, activePoints.size() - 1);
-
-                int idx = dist(generator);
+                int idx = random.uniformInt(
+                    0, static_cast<int>(activePoints.size()) - 1);
 
                 auto activePoint = activePoints[idx];
 
                 bool found = false;
 
                 for (int count = 0; count < K; count++) {
-                    auto angle  = distAngle(generator);
-                    auto length = distL(generator);
+                    float angle  = random.angle();
+                    float length = random.uniform(R, 2.F * R);
 
-                    sf::Vector2f sample{std::cos(angle) * length,
-                                        std::sin(angle) * length};
+                    float cs = 0.F;
+                    float sn = 0.F;
+                    simlab::math::sincos(angle, sn, cs);
+                    sf::Vector2f sample{cs * length, sn * length};
 
                     sample += activePoint.getPosition();
 
@@ -0,0 +1,476 @@
+#include "simlab/core/AllocationTracker.hpp"
+
+#include <fmt/core.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <vector>
+
+#if defined(__GLIBC__)
+#include <cxxabi.h>
+#include <dlfcn.h>
+#include <execinfo.h>
+#endif
+
+namespace simlab {
+
+    namespace {
+
+        /**
+         * Everything touched from operator new is constant-initialized and
+         * trivially destructible, so the hooks work before main() and
+         * during static destruction
+         */
+        struct ThreadSlot {
+            std::atomic<std::uint64_t> allocations{0};
+            std::atomic<std::uint64_t> frees{0};
+            std::atomic<std::uint64_t> bytes{0};
+        };
+
+        struct Site {
+            std::atomic<std::uint64_t>                      key{0};
+            std::atomic<std::uint64_t>                      count{0};
+            std::atomic<std::uint64_t>                      bytes{0};
+            std::atomic<int>                                depth{0};
+            std::array<void*, AllocationTracker::SiteDepth> frames{};
+        };
+
+        std::array<ThreadSlot, AllocationTracker::MaxThreads> Slots;
+        std::atomic<std::size_t>                              NextSlot{0};
+
+        std::array<Site, AllocationTracker::MaxSites> Sites;
+        std::atomic<bool>                             CaptureSites{false};
+        std::atomic<bool>                             SteadyState{false};
+        std::atomic<int>                              OpenFrames{0};
+        std::atomic<std::uint64_t>                    DroppedSites{0};
+
+        std::atomic<std::uint64_t> FrameCount{0};
+        std::atomic<std::uint64_t> AllocatingFrames{0};
+        std::atomic<std::uint64_t> FrameAllocations{0};
+        std::atomic<std::uint64_t> MaxFrameAllocations{0};
+        std::atomic<std::uint64_t> LastFrameAllocations{0};
+        std::atomic<std::uint64_t> LastFrameFrees{0};
+        std::atomic<std::uint64_t> LastFrameBytes{0};
+
+        thread_local int                       t_slot = -1;
+        thread_local AllocationTracker::Counts t_frameStart;
+
+        // Warmup frames before site capture starts; 0 keeps it off
+        auto siteWarmupFrames() -> std::uint64_t {
+            static const std::uint64_t frames = []() -> std::uint64_t {
+                const char* value = std::getenv("SIMLAB_ALLOC_SITES");
+                if (value == nullptr || *value == '\0') {
+                    return 0;
+                }
+                return std::max<std::uint64_t>(
+                    std::strtoull(value, nullptr, 10), 1);
+            }();
+            return frames;
+        }
+
+        auto threadSlot() -> ThreadSlot& {
+            if (t_slot < 0) {
+                std::size_t slot = NextSlot.fetch_add(1);
+                t_slot = static_cast<int>(
+                    std::min(slot, AllocationTracker::MaxThreads - 1));
+            }
+            return Slots[t_slot];
+        }
+
+        auto load(const ThreadSlot& slot) -> AllocationTracker::Counts {
+            return {slot.allocations.load(std::memory_order_relaxed),
+                    slot.frees.load(std::memory_order_relaxed),
+                    slot.bytes.load(std::memory_order_relaxed)};
+        }
+
+#ifdef SIMLAB_TRACK_ALLOCATIONS
+        // Only the owning thread writes its slot, except the shared last one
+        void bump(std::atomic<std::uint64_t>& counter, std::uint64_t value) {
+            counter.fetch_add(value, std::memory_order_relaxed);
+        }
+
+#if defined(__GLIBC__)
+        thread_local bool t_inHook = false;
+
+        /**
+         * Frames are taken from the caller of operator new on; the caller
+         * is located by address because operator new may be tail-called
+         * away and would make a fixed frame skip unreliable
+         */
+        void recordSite(std::size_t size, void* caller) {
+            constexpr int MaxDepth = AllocationTracker::SiteDepth + 8;
+
+            std::array<void*, MaxDepth> raw{};
+            int total = backtrace(raw.data(), MaxDepth);
+            int first = 0;
+            while (first < total && raw[first] != caller) {
+                first++;
+            }
+            if (first == total) {
+                raw[0] = caller;
+                first  = 0;
+                total  = 1;
+            }
+            int depth = std::min(total - first, AllocationTracker::SiteDepth);
+
+            // FNV-1a over the return addresses; 0 marks an empty slot
+            std::uint64_t key = 14695981039346656037ULL;
+            for (int i = 0; i < depth; i++) {
+                key ^= reinterpret_cast<std::uintptr_t>(raw[first + i]);
+                key *= 1099511628211ULL;
+            }
+            key |= 1U;
+
+            for (std::size_t probe = 0; probe < 64; probe++) {
+                Site& site = Sites[(key + probe) % Sites.size()];
+
+                std::uint64_t current =
+                    site.key.load(std::memory_order_acquire);
+                if (current == 0 &&
+                    site.key.compare_exchange_strong(current, key)) {
+                    std::copy_n(raw.begin() + first, depth,
+                                site.frames.begin());
+                    site.depth.store(depth, std::memory_order_release);
+                    current = key;
+                }
+                if (current == key) {
+                    bump(site.count, 1);
+                    bump(site.bytes, size);
+                    return;
+                }
+            }
+            DroppedSites.fetch_add(1, std::memory_order_relaxed);
+        }
+#endif
+
+        auto allocate(std::size_t size, std::size_t alignment,
+                      [[maybe_unused]] void* caller) -> void* {
+            size = std::max<std::size_t>(size, 1);
+            while (true) {
+                void* ptr = alignment <= __STDCPP_DEFAULT_NEW_ALIGNMENT__
+                                ? std::malloc(size)
+                                : std::aligned_alloc(
+                                      alignment, (size + alignment - 1) /
+                                                     alignment * alignment);
+                if (ptr != nullptr) {
+                    ThreadSlot& slot = threadSlot();
+                    bump(slot.allocations, 1);
+                    bump(slot.bytes, size);
+#if defined(__GLIBC__)
+                    bool capture =
+                        CaptureSites.load(std::memory_order_relaxed) ||
+                        (SteadyState.load(std::memory_order_relaxed) &&
+                         OpenFrames.load(std::memory_order_relaxed) > 0);
+                    if (capture && !t_inHook) {
+                        t_inHook = true;
+                        recordSite(size, caller);
+                        t_inHook = false;
+                    }
+#endif
+                    return ptr;
+                }
+
+                std::new_handler handler = std::get_new_handler();
+                if (handler == nullptr) {
+                    throw std::bad_alloc();
+                }
+                handler();
+            }
+        }
+
+        void deallocate(void* ptr) noexcept {
+            if (ptr == nullptr) {
+                return;
+            }
+            bump(threadSlot().frees, 1);
+            std::free(ptr);
+        }
+#endif
+
+        // backtrace() loads libgcc on first use; do that outside a hook
+        void primeBacktrace() {
+#if defined(__GLIBC__)
+            std::array<void*, 1> frames{};
+            backtrace(frames.data(), 1);
+#endif
+        }
+
+        auto symbolize(void* address) -> std::string {
+#if defined(__GLIBC__)
+            Dl_info info{};
+            if (dladdr(address, &info) == 0) {
+                return fmt::format("{}", address);
+            }
+            auto* base = static_cast<char*>(address);
+            if (info.dli_sname != nullptr) {
+                int   status    = 0;
+                char* demangled = abi::__cxa_demangle(info.dli_sname, nullptr,
+                                                      nullptr, &status);
+                std::string name = status == 0 ? demangled : info.dli_sname;
+                std::free(demangled);
+                return fmt::format("{}+{:#x}", name,
+                                   base - static_cast<char*>(info.dli_saddr));
+            }
+            // No symbol: module offset, ready for addr2line
+            return fmt::format("{}+{:#x}", info.dli_fname,
+                               base - static_cast<char*>(info.dli_fbase));
+#else
+            return fmt::format("{}", address);
+#endif
+        }
+
+        // Prints the reports requested through the environment at exit
+        struct ExitReport {
+            ExitReport() {
+                siteWarmupFrames();
+            }
+
+            ExitReport(const ExitReport&)                    = delete;
+            ExitReport(ExitReport&&)                         = delete;
+            auto operator=(const ExitReport&) -> ExitReport& = delete;
+            auto operator=(ExitReport&&) -> ExitReport&      = delete;
+
+            ~ExitReport() {
+                if (!AllocationTracker::isEnabled()) {
+                    return;
+                }
+                const char* report = std::getenv("SIMLAB_ALLOC_REPORT");
+                if (report != nullptr && *report != '\0' && *report != '0') {
+                    AllocationTracker::report();
+                }
+                if (siteWarmupFrames() != 0) {
+                    SteadyState.store(false);
+                    AllocationTracker::setSiteCapture(false);
+                    AllocationTracker::reportSites();
+                }
+            }
+        };
+
+        const ExitReport Reporter;
+    }  // namespace
+
+    auto AllocationTracker::isEnabled() -> bool {
+#ifdef SIMLAB_TRACK_ALLOCATIONS
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    auto AllocationTracker::thread() -> Counts {
+        return load(threadSlot());
+    }
+
+    auto AllocationTracker::total() -> Counts {
+        Counts      sum;
+        std::size_t used = std::min(NextSlot.load(), MaxThreads);
+        for (std::size_t i = 0; i < used; i++) {
+            Counts counts = load(Slots[i]);
+            sum.allocations += counts.allocations;
+            sum.frees += counts.frees;
+            sum.bytes += counts.bytes;
+        }
+        return sum;
+    }
+
+    void AllocationTracker::beginFrame() {
+        t_frameStart = thread();
+        OpenFrames.fetch_add(1);
+    }
+
+    auto AllocationTracker::endFrame() -> Counts {
+        Counts frame = thread() - t_frameStart;
+        OpenFrames.fetch_sub(1);
+
+        LastFrameAllocations.store(frame.allocations);
+        LastFrameFrees.store(frame.frees);
+        LastFrameBytes.store(frame.bytes);
+
+        std::uint64_t frames = FrameCount.fetch_add(1) + 1;
+        std::uint64_t warmup = siteWarmupFrames();
+        if (frames > warmup) {
+            FrameAllocations.fetch_add(frame.allocations);
+            if (frame.allocations != 0) {
+                AllocatingFrames.fetch_add(1);
+            }
+            std::uint64_t max = MaxFrameAllocations.load();
+            while (frame.allocations > max &&
+                   !MaxFrameAllocations.compare_exchange_weak(
+                       max, frame.allocations)) {
+            }
+        }
+        if (warmup != 0 && frames == warmup) {
+            primeBacktrace();
+            SteadyState.store(true);
+        }
+        return frame;
+    }
+
+    auto AllocationTracker::getLastFrame() -> Counts {
+        return {LastFrameAllocations.load(), LastFrameFrees.load(),
+                LastFrameBytes.load()};
+    }
+
+    auto AllocationTracker::getFrameCount() -> std::uint64_t {
+        return FrameCount.load();
+    }
+
+    void AllocationTracker::setSiteCapture(bool enable) {
+        if (enable) {
+            primeBacktrace();
+        }
+        CaptureSites.store(enable);
+    }
+
+    auto AllocationTracker::isCapturingSites() -> bool {
+        return CaptureSites.load();
+    }
+
+    void AllocationTracker::report() {
+        std::size_t used = std::min(NextSlot.load(), MaxThreads);
+
+        fmt::print(stderr, "=== Allocations ===\n");
+        for (std::size_t i = 0; i < used; i++) {
+            Counts counts = load(Slots[i]);
+            fmt::print(stderr,
+                       "  Thread {:<4}: {} allocs, {} frees, {:.1f} KiB\n",
+                       i + 1, counts.allocations, counts.frees,
+                       static_cast<double>(counts.bytes) / 1024.0);
+        }
+
+        std::uint64_t frames   = FrameCount.load();
+        std::uint64_t warmup   = std::min(siteWarmupFrames(), frames);
+        std::uint64_t measured = frames - warmup;
+        if (measured != 0) {
+            fmt::print(stderr,
+                       "  Frames     : {} ({} warmup)\n"
+                       "  Allocating : {} frames\n"
+                       "  Per frame  : {:.2f} avg, {} max\n",
+                       frames, warmup, AllocatingFrames.load(),
+                       static_cast<double>(FrameAllocations.load()) /
+                           static_cast<double>(measured),
+                       MaxFrameAllocations.load());
+        }
+    }
+
+    void AllocationTracker::reportSites(std::size_t limit) {
+        std::vector<const Site*> used;
+        for (const auto& site : Sites) {
+            if (site.depth.load(std::memory_order_acquire) > 0) {
+                used.push_back(&site);
+            }
+        }
+        std::sort(used.begin(), used.end(),
+                  [](const Site* a, const Site* b) -> bool {
+                      return a->count.load() > b->count.load();
+                  });
+
+        fmt::print(stderr, "=== Allocation sites after frame {} ===\n",
+                   siteWarmupFrames());
+        if (used.empty()) {
+            fmt::print(stderr, "  none\n");
+        }
+        for (std::size_t i = 0; i < std::min(limit, used.size()); i++) {
+            const Site* site = used[i];
+            fmt::print(stderr, "  {} allocs, {} bytes\n", site->count.load(),
+                       site->bytes.load());
+            int depth = site->depth.load(std::memory_order_acquire);
+            for (int frame = 0; frame < depth; frame++) {
+                fmt::print(stderr, "      {}\n",
+                           symbolize(site->frames[frame]));
+            }
+        }
+        if (DroppedSites.load() != 0) {
+            fmt::print(stderr, "  ({} allocations missed, site table full)\n",
+                       DroppedSites.load());
+        }
+    }
+}  // namespace simlab
+
+#ifdef SIMLAB_TRACK_ALLOCATIONS
+// Replacements for the global allocation functions; all of them funnel into
+// allocate()/deallocate() so every form is counted the same way
+
+auto operator new(std::size_t size) -> void* {
+    return simlab::allocate(size, 0, __builtin_return_address(0));
+}
+
+auto operator new[](std::size_t size) -> void* {
+    return simlab::allocate(size, 0, __builtin_return_address(0));
+}
+
+auto operator new(std::size_t size, std::align_val_t alignment) -> void* {
+    return simlab::allocate(size, static_cast<std::size_t>(alignment),
+                            __builtin_return_address(0));
+}
+
+auto operator new[](std::size_t size, std::align_val_t alignment) -> void* {
+    return simlab::allocate(size, static_cast<std::size_t>(alignment),
+                            __builtin_return_address(0));
+}
+
+auto operator new(std::size_t size, const std::nothrow_t& /*tag*/) noexcept
+    -> void* {
+    try {
+        return simlab::allocate(size, 0, __builtin_return_address(0));
+    } catch (const std::bad_alloc&) {
+        return nullptr;
+    }
+}
+
+auto operator new[](std::size_t size, const std::nothrow_t& /*tag*/) noexcept
+    -> void* {
+    try {
+        return simlab::allocate(size, 0, __builtin_return_address(0));
+    } catch (const std::bad_alloc&) {
+        return nullptr;
+    }
+}
+
+void operator delete(void* ptr) noexcept {
+    simlab::deallocate(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+    simlab::deallocate(ptr);
+}
+
+void operator delete(void* ptr, std::size_t /*size*/) noexcept {
+    simlab::deallocate(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t /*size*/) noexcept {
+    simlab::deallocate(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t /*alignment*/) noexcept {
+    simlab::deallocate(ptr);
+}
+
+void operator delete[](void* ptr, std::align_val_t /*alignment*/) noexcept {
+    simlab::deallocate(ptr);
+}
+
+void operator delete(void* ptr, std::size_t /*size*/,
+                     std::align_val_t /*alignment*/) noexcept {
+    simlab::deallocate(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t /*size*/,
+                       std::align_val_t /*alignment*/) noexcept {
+    simlab::deallocate(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t& /*tag*/) noexcept {
+    simlab::deallocate(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t& /*tag*/) noexcept {
+    simlab::deallocate(ptr);
+}
+#endif
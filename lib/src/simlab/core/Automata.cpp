@@ -0,0 +1,76 @@
+#include "simlab/core/Automata.hpp"
+
+#include "simlab/core/Random.hpp"
+
+namespace simlab {
+
+    auto Automata::randomGrid(std::size_t size, float density,
+                              std::uint64_t seed) -> Grid {
+        Random random(seed);
+
+        Grid grid(size, std::vector<bool>(size));
+        for (auto& row : grid) {
+            for (auto&& cell : row) {
+                cell = random.chance(density);
+            }
+        }
+        return grid;
+    }
+
+    auto Automata::countNeighbours(const Grid& grid, int row, int col,
+                                   bool wrap) -> int {
+        const int height = static_cast<int>(grid.size());
+        const int width  = static_cast<int>(grid[row].size());
+
+        int sum = 0;
+        for (int di = -1; di <= 1; di++) {
+            for (int dj = -1; dj <= 1; dj++) {
+                if (di == 0 && dj == 0) {
+                    continue;  // skip self
+                }
+
+                int ni = row + di;
+                int nj = col + dj;
+                if (wrap) {
+                    ni = (ni + height) % height;
+                    nj = (nj + width) % width;
+                } else if (ni < 0 || ni >= height || nj < 0 || nj >= width) {
+                    continue;
+                }
+
+                if (grid[ni][nj]) {
+                    sum++;
+                }
+            }
+        }
+        return sum;
+    }
+
+    void Automata::lifeStep(const Grid& grid, Grid& next,
+                            const LifeRule& rule) {
+        const int height = static_cast<int>(grid.size());
+
+        next.resize(height);
+        for (int i = 0; i < height; i++) {
+            const int width = static_cast<int>(grid[i].size());
+            next[i].resize(width);
+            for (int j = 0; j < width; j++) {
+                next[i][j] = rule.nextState(
+                    grid[i][j], countNeighbours(grid, i, j, rule.wrap));
+            }
+        }
+    }
+
+    void Automata::elementaryStep(std::uint8_t             rule,
+                                  const std::vector<bool>& states,
+                                  std::vector<bool>&       next) {
+        const int width = static_cast<int>(states.size());
+
+        next.resize(width);
+        for (int i = 0; i < width; i++) {
+            next[i] = elementaryNextState(rule,
+                                          states[(i - 1 + width) % width],
+                                          states[i], states[(i + 1) % width]);
+        }
+    }
+}  // namespace simlab
@@ -0,0 +1,480 @@
+#include "simlab/core/BatchMath.hpp"
+
+#include <fmt/core.h>
+
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <stdexcept>
+#include <string_view>
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#define SIMLAB_BATCH_HAS_SSE
+#if defined(__GNUC__)
+#define SIMLAB_BATCH_HAS_AVX2
+#define SIMLAB_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+namespace simlab {
+
+    namespace {
+
+        struct Kernels {
+            BatchMath::Isa isa;
+            void (*length)(const float*, const float*, float*, std::size_t);
+            void (*normalize)(float*, float*, std::size_t);
+            void (*dot)(const float*, const float*, const float*,
+                        const float*, float*, std::size_t);
+            void (*axpy)(float, const float*, float*, std::size_t);
+            void (*reflect)(float*, float*, const float*, const float*,
+                            std::size_t);
+            void (*rotate)(float*, float*, float, float, std::size_t);
+            void (*clamp)(float*, float*, float, float, float, float,
+                          std::size_t);
+        };
+
+        // Reference kernels; the vector ones use them for their tails and
+        // repeat their exact operation order
+        namespace scalar {
+
+            void length(const float* x, const float* y, float* out,
+                        std::size_t n) {
+                for (std::size_t i = 0; i < n; i++) {
+                    out[i] = std::sqrt((x[i] * x[i]) + (y[i] * y[i]));
+                }
+            }
+
+            void normalize(float* x, float* y, std::size_t n) {
+                for (std::size_t i = 0; i < n; i++) {
+                    float len = std::sqrt((x[i] * x[i]) + (y[i] * y[i]));
+                    x[i]      = len != 0.F ? x[i] / len : 0.F;
+                    y[i]      = len != 0.F ? y[i] / len : 0.F;
+                }
+            }
+
+            void dot(const float* ax, const float* ay, const float* bx,
+                     const float* by, float* out, std::size_t n) {
+                for (std::size_t i = 0; i < n; i++) {
+                    out[i] = (ax[i] * bx[i]) + (ay[i] * by[i]);
+                }
+            }
+
+            void axpy(float a, const float* x, float* y, std::size_t n) {
+                for (std::size_t i = 0; i < n; i++) {
+                    y[i] += a * x[i];
+                }
+            }
+
+            void reflect(float* vx, float* vy, const float* nx,
+                         const float* ny, std::size_t n) {
+                for (std::size_t i = 0; i < n; i++) {
+                    float k = 2.F * ((vx[i] * nx[i]) + (vy[i] * ny[i]));
+                    vx[i] -= k * nx[i];
+                    vy[i] -= k * ny[i];
+                }
+            }
+
+            void rotate(float* x, float* y, float cs, float sn,
+                        std::size_t n) {
+                for (std::size_t i = 0; i < n; i++) {
+                    float rx = (x[i] * cs) - (y[i] * sn);
+                    float ry = (x[i] * sn) + (y[i] * cs);
+                    x[i]     = rx;
+                    y[i]     = ry;
+                }
+            }
+
+            // Written like maxps/minps so NaN clamps to the minimum
+            auto clampValue(float v, float lo, float hi) -> float {
+                v = v > lo ? v : lo;
+                return v < hi ? v : hi;
+            }
+
+            void clamp(float* x, float* y, float minX, float minY,
+                       float maxX, float maxY, std::size_t n) {
+                for (std::size_t i = 0; i < n; i++) {
+                    x[i] = clampValue(x[i], minX, maxX);
+                    y[i] = clampValue(y[i], minY, maxY);
+                }
+            }
+
+            constexpr Kernels Table{BatchMath::Isa::Scalar, length, normalize,
+                                    dot, axpy, reflect, rotate, clamp};
+        }  // namespace scalar
+
+#if defined(SIMLAB_BATCH_HAS_SSE)
+        namespace sse {
+
+            constexpr std::size_t Width = 4;
+
+            void length(const float* x, const float* y, float* out,
+                        std::size_t n) {
+                std::size_t i = 0;
+                for (; i + Width <= n; i += Width) {
+                    __m128 vx = _mm_loadu_ps(x + i);
+                    __m128 vy = _mm_loadu_ps(y + i);
+                    __m128 sq =
+                        _mm_add_ps(_mm_mul_ps(vx, vx), _mm_mul_ps(vy, vy));
+                    _mm_storeu_ps(out + i, _mm_sqrt_ps(sq));
+                }
+                scalar::length(x + i, y + i, out + i, n - i);
+            }
+
+            void normalize(float* x, float* y, std::size_t n) {
+                const __m128 zero = _mm_setzero_ps();
+                std::size_t  i    = 0;
+                for (; i + Width <= n; i += Width) {
+                    __m128 vx  = _mm_loadu_ps(x + i);
+                    __m128 vy  = _mm_loadu_ps(y + i);
+                    __m128 len = _mm_sqrt_ps(
+                        _mm_add_ps(_mm_mul_ps(vx, vx), _mm_mul_ps(vy, vy)));
+                    // Lanes with zero length divide to NaN and are masked
+                    __m128 keep = _mm_cmpneq_ps(len, zero);
+                    _mm_storeu_ps(x + i, _mm_and_ps(_mm_div_ps(vx, len), keep));
+                    _mm_storeu_ps(y + i, _mm_and_ps(_mm_div_ps(vy, len), keep));
+                }
+                scalar::normalize(x + i, y + i, n - i);
+            }
+
+            void dot(const float* ax, const float* ay, const float* bx,
+                     const float* by, float* out, std::size_t n) {
+                std::size_t i = 0;
+                for (; i + Width <= n; i += Width) {
+                    __m128 xx =
+                        _mm_mul_ps(_mm_loadu_ps(ax + i), _mm_loadu_ps(bx + i));
+                    __m128 yy =
+                        _mm_mul_ps(_mm_loadu_ps(ay + i), _mm_loadu_ps(by + i));
+                    _mm_storeu_ps(out + i, _mm_add_ps(xx, yy));
+                }
+                scalar::dot(ax + i, ay + i, bx + i, by + i, out + i, n - i);
+            }
+
+            void axpy(float a, const float* x, float* y, std::size_t n) {
+                const __m128 va = _mm_set1_ps(a);
+                std::size_t  i  = 0;
+                for (; i + Width <= n; i += Width) {
+                    __m128 ax = _mm_mul_ps(va, _mm_loadu_ps(x + i));
+                    _mm_storeu_ps(y + i, _mm_add_ps(_mm_loadu_ps(y + i), ax));
+                }
+                scalar::axpy(a, x + i, y + i, n - i);
+            }
+
+            void reflect(float* vx, float* vy, const float* nx,
+                         const float* ny, std::size_t n) {
+                const __m128 two = _mm_set1_ps(2.F);
+                std::size_t  i   = 0;
+                for (; i + Width <= n; i += Width) {
+                    __m128 x  = _mm_loadu_ps(vx + i);
+                    __m128 y  = _mm_loadu_ps(vy + i);
+                    __m128 nX = _mm_loadu_ps(nx + i);
+                    __m128 nY = _mm_loadu_ps(ny + i);
+                    __m128 k  = _mm_mul_ps(
+                        two, _mm_add_ps(_mm_mul_ps(x, nX), _mm_mul_ps(y, nY)));
+                    _mm_storeu_ps(vx + i, _mm_sub_ps(x, _mm_mul_ps(k, nX)));
+                    _mm_storeu_ps(vy + i, _mm_sub_ps(y, _mm_mul_ps(k, nY)));
+                }
+                scalar::reflect(vx + i, vy + i, nx + i, ny + i, n - i);
+            }
+
+            void rotate(float* x, float* y, float cs, float sn,
+                        std::size_t n) {
+                const __m128 c = _mm_set1_ps(cs);
+                const __m128 s = _mm_set1_ps(sn);
+                std::size_t  i = 0;
+                for (; i + Width <= n; i += Width) {
+                    __m128 vx = _mm_loadu_ps(x + i);
+                    __m128 vy = _mm_loadu_ps(y + i);
+                    _mm_storeu_ps(x + i, _mm_sub_ps(_mm_mul_ps(vx, c),
+                                                    _mm_mul_ps(vy, s)));
+                    _mm_storeu_ps(y + i, _mm_add_ps(_mm_mul_ps(vx, s),
+                                                    _mm_mul_ps(vy, c)));
+                }
+                scalar::rotate(x + i, y + i, cs, sn, n - i);
+            }
+
+            void clamp(float* x, float* y, float minX, float minY,
+                       float maxX, float maxY, std::size_t n) {
+                const __m128 loX = _mm_set1_ps(minX);
+                const __m128 loY = _mm_set1_ps(minY);
+                const __m128 hiX = _mm_set1_ps(maxX);
+                const __m128 hiY = _mm_set1_ps(maxY);
+                std::size_t  i   = 0;
+                for (; i + Width <= n; i += Width) {
+                    __m128 vx = _mm_max_ps(_mm_loadu_ps(x + i), loX);
+                    __m128 vy = _mm_max_ps(_mm_loadu_ps(y + i), loY);
+                    _mm_storeu_ps(x + i, _mm_min_ps(vx, hiX));
+                    _mm_storeu_ps(y + i, _mm_min_ps(vy, hiY));
+                }
+                scalar::clamp(x + i, y + i, minX, minY, maxX, maxY, n - i);
+            }
+
+            constexpr Kernels Table{BatchMath::Isa::SSE, length, normalize,
+                                    dot, axpy, reflect, rotate, clamp};
+        }  // namespace sse
+#endif
+
+#if defined(SIMLAB_BATCH_HAS_AVX2)
+        // Compiled for AVX2 here only; reached after a CPU check
+        namespace avx2 {
+
+            constexpr std::size_t Width = 8;
+
+            SIMLAB_TARGET_AVX2 void length(const float* x, const float* y,
+                                           float* out, std::size_t n) {
+                std::size_t i = 0;
+                for (; i + Width <= n; i += Width) {
+                    __m256 vx = _mm256_loadu_ps(x + i);
+                    __m256 vy = _mm256_loadu_ps(y + i);
+                    __m256 sq = _mm256_add_ps(_mm256_mul_ps(vx, vx),
+                                              _mm256_mul_ps(vy, vy));
+                    _mm256_storeu_ps(out + i, _mm256_sqrt_ps(sq));
+                }
+                scalar::length(x + i, y + i, out + i, n - i);
+            }
+
+            SIMLAB_TARGET_AVX2 void normalize(float* x, float* y,
+                                              std::size_t n) {
+                const __m256 zero = _mm256_setzero_ps();
+                std::size_t  i    = 0;
+                for (; i + Width <= n; i += Width) {
+                    __m256 vx  = _mm256_loadu_ps(x + i);
+                    __m256 vy  = _mm256_loadu_ps(y + i);
+                    __m256 len = _mm256_sqrt_ps(_mm256_add_ps(
+                        _mm256_mul_ps(vx, vx), _mm256_mul_ps(vy, vy)));
+                    __m256 keep = _mm256_cmp_ps(len, zero, _CMP_NEQ_UQ);
+                    _mm256_storeu_ps(
+                        x + i, _mm256_and_ps(_mm256_div_ps(vx, len), keep));
+                    _mm256_storeu_ps(
+                        y + i, _mm256_and_ps(_mm256_div_ps(vy, len), keep));
+                }
+                scalar::normalize(x + i, y + i, n - i);
+            }
+
+            SIMLAB_TARGET_AVX2 void dot(const float* ax, const float* ay,
+                                        const float* bx, const float* by,
+                                        float* out, std::size_t n) {
+                std::size_t i = 0;
+                for (; i + Width <= n; i += Width) {
+                    __m256 xx = _mm256_mul_ps(_mm256_loadu_ps(ax + i),
+                                              _mm256_loadu_ps(bx + i));
+                    __m256 yy = _mm256_mul_ps(_mm256_loadu_ps(ay + i),
+                                              _mm256_loadu_ps(by + i));
+                    _mm256_storeu_ps(out + i, _mm256_add_ps(xx, yy));
+                }
+                scalar::dot(ax + i, ay + i, bx + i, by + i, out + i, n - i);
+            }
+
+            SIMLAB_TARGET_AVX2 void axpy(float a, const float* x, float* y,
+                                         std::size_t n) {
+                const __m256 va = _mm256_set1_ps(a);
+                std::size_t  i  = 0;
+                for (; i + Width <= n; i += Width) {
+                    __m256 ax = _mm256_mul_ps(va, _mm256_loadu_ps(x + i));
+                    _mm256_storeu_ps(y + i,
+                                     _mm256_add_ps(_mm256_loadu_ps(y + i), ax));
+                }
+                scalar::axpy(a, x + i, y + i, n - i);
+            }
+
+            SIMLAB_TARGET_AVX2 void reflect(float* vx, float* vy,
+                                            const float* nx, const float* ny,
+                                            std::size_t n) {
+                const __m256 two = _mm256_set1_ps(2.F);
+                std::size_t  i   = 0;
+                for (; i + Width <= n; i += Width) {
+                    __m256 x  = _mm256_loadu_ps(vx + i);
+                    __m256 y  = _mm256_loadu_ps(vy + i);
+                    __m256 nX = _mm256_loadu_ps(nx + i);
+                    __m256 nY = _mm256_loadu_ps(ny + i);
+                    __m256 k  = _mm256_mul_ps(
+                        two, _mm256_add_ps(_mm256_mul_ps(x, nX),
+                                           _mm256_mul_ps(y, nY)));
+                    _mm256_storeu_ps(vx + i,
+                                     _mm256_sub_ps(x, _mm256_mul_ps(k, nX)));
+                    _mm256_storeu_ps(vy + i,
+                                     _mm256_sub_ps(y, _mm256_mul_ps(k, nY)));
+                }
+                scalar::reflect(vx + i, vy + i, nx + i, ny + i, n - i);
+            }
+
+            SIMLAB_TARGET_AVX2 void rotate(float* x, float* y, float cs,
+                                           float sn, std::size_t n) {
+                const __m256 c = _mm256_set1_ps(cs);
+                const __m256 s = _mm256_set1_ps(sn);
+                std::size_t  i = 0;
+                for (; i + Width <= n; i += Width) {
+                    __m256 vx = _mm256_loadu_ps(x + i);
+                    __m256 vy = _mm256_loadu_ps(y + i);
+                    _mm256_storeu_ps(x + i,
+                                     _mm256_sub_ps(_mm256_mul_ps(vx, c),
+                                                   _mm256_mul_ps(vy, s)));
+                    _mm256_storeu_ps(y + i,
+                                     _mm256_add_ps(_mm256_mul_ps(vx, s),
+                                                   _mm256_mul_ps(vy, c)));
+                }
+                scalar::rotate(x + i, y + i, cs, sn, n - i);
+            }
+
+            SIMLAB_TARGET_AVX2 void clamp(float* x, float* y, float minX,
+                                          float minY, float maxX, float maxY,
+                                          std::size_t n) {
+                const __m256 loX = _mm256_set1_ps(minX);
+                const __m256 loY = _mm256_set1_ps(minY);
+                const __m256 hiX = _mm256_set1_ps(maxX);
+                const __m256 hiY = _mm256_set1_ps(maxY);
+                std::size_t  i   = 0;
+                for (; i + Width <= n; i += Width) {
+                    __m256 vx = _mm256_max_ps(_mm256_loadu_ps(x + i), loX);
+                    __m256 vy = _mm256_max_ps(_mm256_loadu_ps(y + i), loY);
+                    _mm256_storeu_ps(x + i, _mm256_min_ps(vx, hiX));
+                    _mm256_storeu_ps(y + i, _mm256_min_ps(vy, hiY));
+                }
+                scalar::clamp(x + i, y + i, minX, minY, maxX, maxY, n - i);
+            }
+
+            constexpr Kernels Table{BatchMath::Isa::AVX2, length, normalize,
+                                    dot, axpy, reflect, rotate, clamp};
+        }  // namespace avx2
+#endif
+
+        auto tableFor(BatchMath::Isa isa) -> const Kernels* {
+            switch (isa) {
+#if defined(SIMLAB_BATCH_HAS_AVX2)
+                case BatchMath::Isa::AVX2:
+                    return &avx2::Table;
+#endif
+#if defined(SIMLAB_BATCH_HAS_SSE)
+                case BatchMath::Isa::SSE:
+                    return &sse::Table;
+#endif
+                default:
+                    return &scalar::Table;
+            }
+        }
+
+        auto best() -> BatchMath::Isa {
+            if (BatchMath::isSupported(BatchMath::Isa::AVX2)) {
+                return BatchMath::Isa::AVX2;
+            }
+            if (BatchMath::isSupported(BatchMath::Isa::SSE)) {
+                return BatchMath::Isa::SSE;
+            }
+            return BatchMath::Isa::Scalar;
+        }
+
+        // SIMLAB_BATCH_ISA=scalar|sse|avx2 caps the choice, for comparisons
+        auto initialIsa() -> BatchMath::Isa {
+            const char* env = std::getenv("SIMLAB_BATCH_ISA");
+            if (env == nullptr) {
+                return best();
+            }
+            std::string_view name(env);
+            for (auto isa : {BatchMath::Isa::Scalar, BatchMath::Isa::SSE,
+                             BatchMath::Isa::AVX2}) {
+                if (name == BatchMath::getIsaName(isa) &&
+                    BatchMath::isSupported(isa)) {
+                    return isa;
+                }
+            }
+            fmt::print(stderr,
+                       "SIMLAB_BATCH_ISA={} is unknown or unsupported, using "
+                       "{}\n",
+                       name, BatchMath::getIsaName(best()));
+            return best();
+        }
+
+        std::atomic<const Kernels*> active{nullptr};
+
+        auto kernels() -> const Kernels& {
+            const Kernels* table = active.load(std::memory_order_acquire);
+            if (table == nullptr) {
+                // Racing first calls pick the same table
+                table = tableFor(initialIsa());
+                active.store(table, std::memory_order_release);
+            }
+            return *table;
+        }
+    }  // namespace
+
+    void BatchMath::length(const float* x, const float* y, float* out,
+                           std::size_t n) {
+        kernels().length(x, y, out, n);
+    }
+
+    void BatchMath::normalize(float* x, float* y, std::size_t n) {
+        kernels().normalize(x, y, n);
+    }
+
+    void BatchMath::dot(const float* ax, const float* ay, const float* bx,
+                        const float* by, float* out, std::size_t n) {
+        kernels().dot(ax, ay, bx, by, out, n);
+    }
+
+    void BatchMath::axpy(float a, const float* x, float* y, std::size_t n) {
+        kernels().axpy(a, x, y, n);
+    }
+
+    void BatchMath::reflect(float* vx, float* vy, const float* nx,
+                            const float* ny, std::size_t n) {
+        kernels().reflect(vx, vy, nx, ny, n);
+    }
+
+    void BatchMath::rotate(float* x, float* y, float degrees,
+                           std::size_t n) {
+        // Same angle conversion as utils::rotate
+        float rad = degrees * M_PI / 180.F;
+        kernels().rotate(x, y, std::cos(rad), std::sin(rad), n);
+    }
+
+    void BatchMath::clampToRect(float* x, float* y, float minX, float minY,
+                                float maxX, float maxY, std::size_t n) {
+        kernels().clamp(x, y, minX, minY, maxX, maxY, n);
+    }
+
+    auto BatchMath::getIsa() -> Isa {
+        return kernels().isa;
+    }
+
+    void BatchMath::setIsa(Isa isa) {
+        if (!isSupported(isa)) {
+            throw std::runtime_error(
+                fmt::format("BatchMath: {} is not supported on this CPU",
+                            getIsaName(isa)));
+        }
+        active.store(tableFor(isa), std::memory_order_release);
+    }
+
+    auto BatchMath::isSupported(Isa isa) -> bool {
+        switch (isa) {
+            case Isa::Scalar:
+                return true;
+            case Isa::SSE:
+#if defined(SIMLAB_BATCH_HAS_SSE)
+                return true;
+#else
+                return false;
+#endif
+            case Isa::AVX2:
+#if defined(SIMLAB_BATCH_HAS_AVX2)
+                return __builtin_cpu_supports("avx2") != 0;
+#else
+                return false;
+#endif
+        }
+        return false;
+    }
+
+    auto BatchMath::getIsaName(Isa isa) -> const char* {
+        switch (isa) {
+            case Isa::Scalar:
+                return "scalar";
+            case Isa::SSE:
+                return "sse";
+            case Isa::AVX2:
+                return "avx2";
+        }
+        return "unknown";
+    }
+}  // namespace simlab
@@ -0,0 +1,294 @@
+#include "simlab/core/Benchmark.hpp"
+
+#include "simlab/core/BenchmarkUtils.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/utsname.h>
+#include <unistd.h>
+#endif
+
+#ifndef SIMLAB_GIT_REVISION
+#define SIMLAB_GIT_REVISION "unknown"
+#endif
+
+namespace {
+
+    using Metadata = std::vector<std::pair<std::string, std::string>>;
+
+    using simlab::benchmark::escapeCsv;
+
+    void writeJson(const std::string&                    path,
+                   const std::vector<Benchmark::Result>& results);
+
+    void writeCsv(const std::string&                    path,
+                  const std::vector<Benchmark::Result>& results);
+
+    auto endsWith(const std::string& text, const std::string& suffix)
+        -> bool {
+        return text.size() >= suffix.size() &&
+               text.compare(text.size() - suffix.size(), suffix.size(),
+                            suffix) == 0;
+    }
+
+    void writeResults(const std::string&                    path,
+                      const std::vector<Benchmark::Result>& results) {
+        if (endsWith(path, ".json")) {
+            writeJson(path, results);
+        } else {
+            writeCsv(path, results);
+        }
+    }
+
+    struct Registry {
+        std::mutex                     mutex;
+        std::vector<Benchmark*>        live;
+        std::vector<Benchmark::Result> finished;
+
+        Registry()                                   = default;
+        Registry(const Registry&)                    = delete;
+        Registry(Registry&&)                         = delete;
+        auto operator=(const Registry&) -> Registry& = delete;
+        auto operator=(Registry&&) -> Registry&      = delete;
+
+        // Runs after every Benchmark created before the first one is gone
+        ~Registry() {
+            const char* path = std::getenv("SIMLAB_BENCHMARK_EXPORT");
+            if (path == nullptr || *path == '\0') {
+                return;
+            }
+            std::vector<Benchmark::Result> results = finished;
+            for (const Benchmark* benchmark : live) {
+                results.push_back(benchmark->snapshot());
+            }
+            try {
+                writeResults(path, results);
+            } catch (const std::exception& e) {
+                fmt::print(stderr, "Benchmark export failed: {}\n", e.what());
+            }
+        }
+    };
+
+    auto registry() -> Registry& {
+        static Registry instance;
+        return instance;
+    }
+
+    auto openOutput(const std::string& path) -> std::ofstream {
+        std::ofstream file(path, std::ios::out | std::ios::trunc);
+        if (!file.is_open()) {
+            throw std::runtime_error("Failed to open benchmark export: " +
+                                     path);
+        }
+        return file;
+    }
+
+    auto escapeJson(const std::string& text) -> std::string {
+        std::string escaped;
+        escaped.reserve(text.size());
+        for (char c : text) {
+            switch (c) {
+                case '"':
+                    escaped += "\\\"";
+                    break;
+                case '\\':
+                    escaped += "\\\\";
+                    break;
+                case '\n':
+                    escaped += "\\n";
+                    break;
+                default:
+                    if (static_cast<unsigned char>(c) < 0x20) {
+                        escaped += fmt::format("\\u{:04x}", c);
+                    } else {
+                        escaped += c;
+                    }
+            }
+        }
+        return escaped;
+    }
+
+    void writeJson(const std::string&                    path,
+                   const std::vector<Benchmark::Result>& results) {
+        std::ofstream file = openOutput(path);
+
+        file << "{\n  \"metadata\": {";
+        const Metadata metadata = Benchmark::metadata();
+        for (std::size_t i = 0; i < metadata.size(); i++) {
+            file << (i == 0 ? "\n" : ",\n")
+                 << fmt::format("    \"{}\": \"{}\"", metadata[i].first,
+                                escapeJson(metadata[i].second));
+        }
+        file << "\n  },\n  \"benchmarks\": [";
+
+        for (std::size_t i = 0; i < results.size(); i++) {
+            const auto& r = results[i];
+            file << (i == 0 ? "\n" : ",\n")
+                 << fmt::format(
+                        "    {{\"name\": \"{}\", \"runs\": {}, "
+                        "\"mean_ms\": {}, \"stddev_ms\": {}, "
+                        "\"min_ms\": {}, \"p50_ms\": {}, \"p90_ms\": {}, "
+                        "\"p99_ms\": {}, \"p999_ms\": {}, \"max_ms\": {}, "
+                        "\"total_ms\": {}, \"frames\": {}, "
+                        "\"avg_fps\": {}, \"low_fps\": {}, \"ipc\": {}, "
+                        "\"cycles_per_call\": {}, "
+                        "\"instructions_per_call\": {}, "
+                        "\"l1d_misses_per_call\": {}, "
+                        "\"llc_misses_per_call\": {}, "
+                        "\"branch_misses_per_call\": {}}}",
+                        escapeJson(r.name), r.runs, r.meanMs, r.stddevMs,
+                        r.minMs, r.p50Ms, r.p90Ms, r.p99Ms, r.p999Ms,
+                        r.maxMs, r.totalMs, r.frames, r.avgFps, r.lowFps,
+                        r.ipc, r.cyclesPerCall, r.instructionsPerCall,
+                        r.l1dMissesPerCall, r.llcMissesPerCall,
+                        r.branchMissesPerCall);
+        }
+        file << "\n  ]\n}\n";
+    }
+
+    void writeCsv(const std::string&                    path,
+                  const std::vector<Benchmark::Result>& results) {
+        std::ofstream file = openOutput(path);
+
+        for (const auto& [key, value] : Benchmark::metadata()) {
+            file << "# " << key << '=' << value << '\n';
+        }
+        file << "name,runs,mean_ms,stddev_ms,min_ms,p50_ms,p90_ms,p99_ms,"
+                "p999_ms,max_ms,total_ms,frames,avg_fps,low_fps,ipc,"
+                "cycles_per_call,instructions_per_call,l1d_misses_per_call,"
+                "llc_misses_per_call,branch_misses_per_call\n";
+        for (const auto& r : results) {
+            file << fmt::format(
+                "{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{}\n",
+                escapeCsv(r.name), r.runs, r.meanMs, r.stddevMs, r.minMs,
+                r.p50Ms, r.p90Ms, r.p99Ms, r.p999Ms, r.maxMs, r.totalMs,
+                r.frames, r.avgFps, r.lowFps, r.ipc, r.cyclesPerCall,
+                r.instructionsPerCall, r.l1dMissesPerCall, r.llcMissesPerCall,
+                r.branchMissesPerCall);
+        }
+    }
+}  // namespace
+
+void Benchmark::registerInstance(Benchmark* benchmark) {
+    Registry&                   reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    reg.live.push_back(benchmark);
+}
+
+void Benchmark::unregisterInstance(Benchmark* benchmark) {
+    Registry&                   reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+
+    auto it = std::find(reg.live.begin(), reg.live.end(), benchmark);
+    if (it != reg.live.end()) {
+        reg.live.erase(it);
+    }
+    if (benchmark->times.count() != 0) {
+        reg.finished.push_back(benchmark->snapshot());
+    }
+}
+
+auto Benchmark::countersFromEnvironment() -> bool {
+    const char* value = std::getenv("SIMLAB_PERF_COUNTERS");
+    return value != nullptr && *value != '\0' && *value != '0';
+}
+
+void Benchmark::reportCounters() const {
+    auto color = fmt::color::dark_orange;
+
+    bool any = false;
+    for (const auto& calls : counterCalls) {
+        any = any || calls.load(std::memory_order_relaxed) != 0;
+    }
+    if (!any) {
+        fmt::print(fg(color),
+                   "  {:<13}: unavailable (perf_event_open refused)\n",
+                   "Counters");
+        return;
+    }
+
+    if (counterPerCall(Counters::Cycles) > 0.0 &&
+        counterPerCall(Counters::Instructions) > 0.0) {
+        fmt::print(fg(color), "  {:<13}: {:.2f}\n", "IPC",
+                   counterRatio(Counters::Instructions, Counters::Cycles));
+    }
+    for (std::size_t i = 0; i < Counters::Count; i++) {
+        auto counter = static_cast<Counters::Counter>(i);
+        if (counterCalls[i].load(std::memory_order_relaxed) != 0) {
+            fmt::print(fg(color), "  {:<13}: {:.1f} per call\n",
+                       Counters::getName(counter), counterPerCall(counter));
+        }
+    }
+    fmt::print("\n");
+}
+
+auto Benchmark::collectResults() -> std::vector<Result> {
+    Registry&                   reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+
+    std::vector<Result> results = reg.finished;
+    for (const Benchmark* benchmark : reg.live) {
+        results.push_back(benchmark->snapshot());
+    }
+    return results;
+}
+
+auto Benchmark::metadata() -> std::vector<std::pair<std::string, std::string>> {
+    Metadata metadata;
+
+    std::time_t now = std::time(nullptr);
+    metadata.emplace_back("timestamp",
+                          fmt::format("{:%Y-%m-%dT%H:%M:%SZ}",
+                                      fmt::gmtime(now)));
+    metadata.emplace_back("git_revision", SIMLAB_GIT_REVISION);
+#ifdef NDEBUG
+    metadata.emplace_back("build_type", "release");
+#else
+    metadata.emplace_back("build_type", "debug");
+#endif
+#if defined(__clang__)
+    metadata.emplace_back("compiler", "clang " __clang_version__);
+#elif defined(__GNUC__)
+    metadata.emplace_back("compiler", "gcc " __VERSION__);
+#elif defined(_MSC_VER)
+    metadata.emplace_back("compiler", fmt::format("msvc {}", _MSC_VER));
+#endif
+    metadata.emplace_back("cxx_standard", std::to_string(__cplusplus));
+    metadata.emplace_back("cpu_count",
+                          std::to_string(std::thread::hardware_concurrency()));
+
+#if defined(__unix__) || defined(__APPLE__)
+    std::array<char, 256> host{};
+    if (gethostname(host.data(), host.size() - 1) == 0) {
+        metadata.emplace_back("host", host.data());
+    }
+    utsname system{};
+    if (uname(&system) == 0) {
+        metadata.emplace_back("os", fmt::format("{} {}", system.sysname,
+                                                system.release));
+        metadata.emplace_back("arch", system.machine);
+    }
+#endif
+    return metadata;
+}
+
+void Benchmark::exportJson(const std::string& path) {
+    writeJson(path, collectResults());
+}
+
+void Benchmark::exportCsv(const std::string& path) {
+    writeCsv(path, collectResults());
+}
+
+void Benchmark::exportResults(const std::string& path) {
+    writeResults(path, collectResults());
+}
@@ -0,0 +1,245 @@
+#include "simlab/core/BenchmarkRunner.hpp"
+
+#include "simlab/core/Benchmark.hpp"
+#include "simlab/core/BenchmarkUtils.hpp"
+#include "simlab/core/Game.hpp"
+
+#include <fmt/color.h>
+#include <fmt/core.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <numeric>
+#include <stdexcept>
+
+namespace simlab {
+
+    namespace {
+
+        using SteadyClock = std::chrono::steady_clock;
+
+        using benchmark::escapeCsv;
+        using benchmark::studentQuantile;
+
+        auto median(std::vector<double> values) -> double {
+            std::size_t mid = values.size() / 2;
+            std::nth_element(values.begin(), values.begin() + mid,
+                             values.end());
+            double upper = values[mid];
+            if (values.size() % 2 != 0) {
+                return upper;
+            }
+            return (*std::max_element(values.begin(), values.begin() + mid) +
+                    upper) /
+                   2.0;
+        }
+
+        // Log-log slope between two sweep points
+        auto scalingExponent(const BenchmarkRunner::Result& from,
+                             const BenchmarkRunner::Result& to) -> double {
+            if (from.size == 0 || to.size == 0 || from.size == to.size ||
+                from.stepMs.mean <= 0.0 || to.stepMs.mean <= 0.0) {
+                return 0.0;
+            }
+            return std::log(to.stepMs.mean / from.stepMs.mean) /
+                   std::log(static_cast<double>(to.size) /
+                            static_cast<double>(from.size));
+        }
+    }  // namespace
+
+    BenchmarkRunner::BenchmarkRunner() : BenchmarkRunner(Config()) {}
+
+    BenchmarkRunner::BenchmarkRunner(Config config) : m_config(config) {
+        if (m_config.repetitions < 2 || m_config.stepsPerRepetition == 0) {
+            throw std::logic_error(
+                "BenchmarkRunner needs at least 2 repetitions of 1+ steps");
+        }
+        if (m_config.confidence <= 0.0 || m_config.confidence >= 1.0) {
+            throw std::logic_error(
+                "BenchmarkRunner confidence must be in (0, 1)");
+        }
+    }
+
+    auto BenchmarkRunner::run(const std::string&  name,
+                              const StepFunction& step) -> Result {
+        return measure(name, step, 0);
+    }
+
+    auto BenchmarkRunner::run(const std::string& name, const Setup& setup,
+                              std::size_t size) -> Result {
+        StepFunction step = setup(size, m_config.seed);
+        return measure(name, step, size);
+    }
+
+    auto BenchmarkRunner::runGame(const std::string& name,
+                                  const GameFactory& factory, std::size_t size)
+        -> Result {
+        std::unique_ptr<Game> game = factory(size, m_config.seed);
+        return measure(
+            name, [&game](float dt) -> void { game->simulate(dt); }, size);
+    }
+
+    auto BenchmarkRunner::sweep(const std::string&              name,
+                                const Setup&                    setup,
+                                const std::vector<std::size_t>& sizes)
+        -> std::vector<Result> {
+        std::vector<Result> results;
+        results.reserve(sizes.size());
+        for (std::size_t size : sizes) {
+            results.push_back(
+                run(fmt::format("{}/{}", name, size), setup, size));
+        }
+        return results;
+    }
+
+    auto BenchmarkRunner::sweepGame(const std::string&              name,
+                                    const GameFactory&              factory,
+                                    const std::vector<std::size_t>& sizes)
+        -> std::vector<Result> {
+        std::vector<Result> results;
+        results.reserve(sizes.size());
+        for (std::size_t size : sizes) {
+            results.push_back(
+                runGame(fmt::format("{}/{}", name, size), factory, size));
+        }
+        return results;
+    }
+
+    auto BenchmarkRunner::measure(const std::string&  name,
+                                  const StepFunction& step,
+                                  std::size_t size) const -> Result {
+        const float dt = m_config.dt;
+
+        // Caches, branch predictors, lazy allocations and CPU clocks settle
+        for (std::size_t i = 0; i < m_config.warmupSteps; i++) {
+            step(dt);
+        }
+
+        std::vector<double> samples;  // ms per step, one per repetition
+        samples.reserve(m_config.repetitions);
+        for (std::size_t rep = 0; rep < m_config.repetitions; rep++) {
+            auto start = SteadyClock::now();
+            for (std::size_t i = 0; i < m_config.stepsPerRepetition; i++) {
+                step(dt);
+            }
+            std::chrono::duration<double, std::milli> elapsed =
+                SteadyClock::now() - start;
+            samples.push_back(elapsed.count() /
+                              static_cast<double>(m_config.stepsPerRepetition));
+        }
+
+        // Iglewicz-Hoaglin: |0.6745 (x - median) / MAD| above the threshold
+        double              center = median(samples);
+        std::vector<double> deviations(samples.size());
+        std::transform(samples.begin(), samples.end(), deviations.begin(),
+                       [center](double x) -> double {
+                           return std::abs(x - center);
+                       });
+        double mad = median(deviations);
+
+        std::vector<double> kept;
+        for (double sample : samples) {
+            if (mad == 0.0 || 0.6745 * std::abs(sample - center) / mad <=
+                                  m_config.outlierThreshold) {
+                kept.push_back(sample);
+            }
+        }
+
+        Result result;
+        result.name     = name;
+        result.size     = size;
+        result.runs     = kept.size();
+        result.rejected = samples.size() - kept.size();
+        result.maxMs    = *std::max_element(kept.begin(), kept.end());
+
+        auto   n    = static_cast<double>(kept.size());
+        double mean = std::accumulate(kept.begin(), kept.end(), 0.0) / n;
+        double variance = 0.0;
+        for (double sample : kept) {
+            variance += (sample - mean) * (sample - mean);
+        }
+        variance        = kept.size() > 1 ? variance / (n - 1.0) : 0.0;
+        result.stddevMs = std::sqrt(variance);
+
+        double halfWidth =
+            kept.size() > 1
+                ? studentQuantile(m_config.confidence, n - 1.0) *
+                      result.stddevMs / std::sqrt(n)
+                : 0.0;
+        result.stepMs = {mean, std::max(mean - halfWidth, 0.0),
+                         mean + halfWidth};
+
+        // 1/x is monotonic, so the interval bounds map across swapped
+        auto perSecond        = [](double ms) -> double {
+            return ms > 0.0 ? 1000.0 / ms : 0.0;
+        };
+        result.stepsPerSecond = {perSecond(result.stepMs.mean),
+                                 perSecond(result.stepMs.upper),
+                                 perSecond(result.stepMs.lower)};
+        return result;
+    }
+
+    void BenchmarkRunner::report(const Result& result) {
+        auto headerColor = fmt::color::cyan;
+        auto color       = fmt::color::light_green;
+
+        fmt::print(fg(headerColor) | fmt::emphasis::italic,
+                   "\n======= Runner: {} =======\n", result.name);
+        fmt::print(fg(color), "  Repetitions : {} kept, {} rejected\n",
+                   result.runs, result.rejected);
+        fmt::print(fg(color), "  Step Time   : {:.4f} ms [{:.4f}, {:.4f}]\n",
+                   result.stepMs.mean, result.stepMs.lower,
+                   result.stepMs.upper);
+        fmt::print(fg(color), "  Std Dev     : {:.4f} ms\n", result.stddevMs);
+        fmt::print(fg(color),
+                   "  Throughput  : {:.1f} steps/s [{:.1f}, {:.1f}]\n",
+                   result.stepsPerSecond.mean, result.stepsPerSecond.lower,
+                   result.stepsPerSecond.upper);
+    }
+
+    void BenchmarkRunner::reportScaling(const std::vector<Result>& results) {
+        auto color = fmt::color::light_green;
+
+        fmt::print(fg(fmt::color::cyan) | fmt::emphasis::italic,
+                   "\n======= Scaling =======\n");
+        fmt::print(fg(color), "  {:>10}  {:>12}  {:>25}  {:>8}\n", "size",
+                   "ms/step", "interval", "exponent");
+        for (std::size_t i = 0; i < results.size(); i++) {
+            const Result& r = results[i];
+            std::string   exponent =
+                i == 0 ? std::string("-")
+                         : fmt::format("{:.2f}",
+                                       scalingExponent(results[i - 1], r));
+            fmt::print(fg(color),
+                       "  {:>10}  {:>12.4f}  [{:>10.4f}, {:>10.4f}]  {:>8}\n",
+                       r.size, r.stepMs.mean, r.stepMs.lower, r.stepMs.upper,
+                       exponent);
+        }
+    }
+
+    void BenchmarkRunner::exportCsv(const std::string&         path,
+                                    const std::vector<Result>& results) {
+        std::ofstream file(path, std::ios::out | std::ios::trunc);
+        if (!file.is_open()) {
+            throw std::runtime_error("Failed to open runner export: " + path);
+        }
+
+        for (const auto& [key, value] : Benchmark::metadata()) {
+            file << "# " << key << '=' << value << '\n';
+        }
+        file << "name,size,runs,rejected,mean_ms,stddev_ms,ci_low_ms,"
+                "ci_high_ms,p99_ms,steps_per_s,steps_per_s_low,"
+                "steps_per_s_high\n";
+        for (const auto& r : results) {
+            file << fmt::format("{},{},{},{},{},{},{},{},{},{},{},{}\n",
+                                escapeCsv(r.name), r.size, r.runs, r.rejected,
+                                r.stepMs.mean, r.stddevMs, r.stepMs.lower,
+                                r.stepMs.upper, r.maxMs,
+                                r.stepsPerSecond.mean,
+                                r.stepsPerSecond.lower,
+                                r.stepsPerSecond.upper);
+        }
+    }
+}  // namespace simlab
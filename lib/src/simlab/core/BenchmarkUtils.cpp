@@ -0,0 +1,117 @@
+#include "simlab/core/BenchmarkUtils.hpp"
+
+#include <cmath>
+
+namespace simlab::benchmark {
+
+    namespace {
+
+        // Continued fraction for the regularized incomplete beta (Lentz)
+        auto betaFraction(double a, double b, double x) -> double {
+            constexpr int    MaxIterations = 200;
+            constexpr double Epsilon       = 1e-12;
+            constexpr double Tiny          = 1e-300;
+
+            double c = 1.0;
+            double d = 1.0 - ((a + b) * x / (a + 1.0));
+            d        = std::abs(d) < Tiny ? Tiny : d;
+            d        = 1.0 / d;
+            double h = d;
+            for (int m = 1; m <= MaxIterations; m++) {
+                double m2 = 2.0 * m;
+                double aa = m * (b - m) * x / ((a + m2 - 1.0) * (a + m2));
+                d         = 1.0 + (aa * d);
+                d         = std::abs(d) < Tiny ? Tiny : d;
+                c         = 1.0 + (aa / c);
+                c         = std::abs(c) < Tiny ? Tiny : c;
+                d         = 1.0 / d;
+                h *= d * c;
+
+                aa = -(a + m) * (a + b + m) * x / ((a + m2) * (a + m2 + 1.0));
+                d  = 1.0 + (aa * d);
+                d  = std::abs(d) < Tiny ? Tiny : d;
+                c  = 1.0 + (aa / c);
+                c  = std::abs(c) < Tiny ? Tiny : c;
+                d  = 1.0 / d;
+                double delta = d * c;
+                h *= delta;
+                if (std::abs(delta - 1.0) < Epsilon) {
+                    break;
+                }
+            }
+            return h;
+        }
+    }  // namespace
+
+    auto incompleteBeta(double a, double b, double x) -> double {
+        if (x <= 0.0) {
+            return 0.0;
+        }
+        if (x >= 1.0) {
+            return 1.0;
+        }
+        double front = std::exp(std::lgamma(a + b) - std::lgamma(a) -
+                                std::lgamma(b) + (a * std::log(x)) +
+                                (b * std::log(1.0 - x)));
+        if (x < (a + 1.0) / (a + b + 2.0)) {
+            return front * betaFraction(a, b, x) / a;
+        }
+        return 1.0 - (front * betaFraction(b, a, 1.0 - x) / b);
+    }
+
+    auto studentCdf(double t, double df) -> double {
+        double tail = 0.5 * incompleteBeta(df / 2.0, 0.5, df / (df + (t * t)));
+        return t >= 0.0 ? 1.0 - tail : tail;
+    }
+
+    auto studentQuantile(double confidence, double df) -> double {
+        // Bisection on the CDF
+        double target = 0.5 + (confidence / 2.0);
+        double low    = 0.0;
+        double high   = 1000.0;
+        for (int i = 0; i < 100; i++) {
+            double mid = 0.5 * (low + high);
+            (studentCdf(mid, df) < target ? low : high) = mid;
+        }
+        return 0.5 * (low + high);
+    }
+
+    auto escapeCsv(const std::string& text) -> std::string {
+        if (text.find_first_of(",\"\n") == std::string::npos) {
+            return text;
+        }
+        std::string escaped = "\"";
+        for (char c : text) {
+            escaped += c;
+            if (c == '"') {
+                escaped += '"';
+            }
+        }
+        return escaped + "\"";
+    }
+
+    auto splitCsv(const std::string& line) -> std::vector<std::string> {
+        std::vector<std::string> fields(1);
+        bool                     quoted = false;
+        for (std::size_t i = 0; i < line.size(); i++) {
+            char c = line[i];
+            if (quoted) {
+                if (c == '"' && i + 1 < line.size() && line[i + 1] == '"') {
+                    fields.back() += '"';
+                    i++;
+                } else if (c == '"') {
+                    quoted = false;
+                } else {
+                    fields.back() += c;
+                }
+            } else if (c == '"') {
+                quoted = true;
+            } else if (c == ',') {
+                fields.emplace_back();
+            } else if (c != '\r') {
+                fields.back() += c;
+            }
+        }
+        return fields;
+    }
+}  // namespace simlab::benchmark
@@ -0,0 +1,59 @@
+#include "simlab/core/ContactGraph.hpp"
+
+#include <algorithm>
+
+namespace simlab {
+
+    void ContactGraph::build(const std::vector<ContactPair>& pairs,
+                             std::size_t                     bodyCount) {
+        static constexpr std::uint8_t OverflowColor = MaxColors;
+
+        m_bodyColorMasks.assign(bodyCount, 0);
+        m_pairColors.resize(pairs.size());
+        m_colorCount = 0;
+
+        // Greedy coloring: take the lowest color neither body already uses
+        std::size_t colorSizes[MaxColors + 1] = {};
+        for (std::size_t i = 0; i < pairs.size(); i++) {
+            auto& maskA = m_bodyColorMasks[pairs[i].bodyA];
+            auto& maskB = m_bodyColorMasks[pairs[i].bodyB];
+
+            std::uint64_t used = maskA | maskB;
+            if (used == ~std::uint64_t{0}) {
+                m_pairColors[i] = OverflowColor;
+                colorSizes[OverflowColor]++;
+                continue;
+            }
+
+            auto color = static_cast<std::uint8_t>(__builtin_ctzll(~used));
+
+            std::uint64_t bit = std::uint64_t{1} << color;
+            maskA |= bit;
+            maskB |= bit;
+
+            m_pairColors[i] = color;
+            colorSizes[color]++;
+            m_colorCount = std::max<std::size_t>(m_colorCount, color + 1);
+        }
+
+        // Counting sort into contiguous batches, overflow last
+        m_batchOffsets.assign(m_colorCount + 2, 0);
+        for (std::size_t color = 0; color < m_colorCount; color++) {
+            m_batchOffsets[color + 1] =
+                m_batchOffsets[color] + colorSizes[color];
+        }
+        m_batchOffsets[m_colorCount + 1] =
+            m_batchOffsets[m_colorCount] + colorSizes[OverflowColor];
+
+        std::size_t cursor[MaxColors + 1];
+        std::copy(m_batchOffsets.begin(), m_batchOffsets.end() - 1, cursor);
+
+        m_pairs.resize(pairs.size());
+        for (std::size_t i = 0; i < pairs.size(); i++) {
+            std::size_t slot = m_pairColors[i] == OverflowColor
+                                   ? cursor[m_colorCount]++
+                                   : cursor[m_pairColors[i]]++;
+            m_pairs[slot]    = pairs[i];
+        }
+    }
+}  // namespace simlab
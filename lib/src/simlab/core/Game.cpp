@@ -1,5 +1,8 @@
 #include "simlab/core/Game.hpp"
 
+#include "simlab/core/AllocationTracker.hpp"
+#include "simlab/core/Profiler.hpp"
+
 namespace simlab {
 
     Game::Game(unsigned int width, unsigned int height,
@@ -28,6 +31,7 @@ namespace simlab {
 
     void Game::Run() {
         Benchmark bm("Game Loop");
+        SIMLAB_PROFILE_THREAD("Main");
         if (m_physicsEngine) {
             physicsManager->setPhysicsFunction(
                 [this](float dt) -> void { this->Update(dt); });
@@ -37,19 +41,32 @@ namespace simlab {
         }
         sf::Clock clock;
         while (window.isOpen()) {
-            Benchmark::Scope scope(bm);
-            float            dt = clock.restart().asSeconds();
+            Benchmark::Scope              scope(bm);
+            AllocationTracker::FrameScope frameAllocations;
+            SIMLAB_PROFILE_ZONE("Frame");
+            float dt = clock.restart().asSeconds();
+            overlay.recordFrame(dt);
             dt *= m_timeScale;
-            pollEvents();
+            {
+                SIMLAB_PROFILE_ZONE("PollEvents");
+                pollEvents();
+            }
             if (!m_physicsEngine) {
-                fixedUpdate(dt);
+                {
+                    SIMLAB_PROFILE_ZONE("FixedUpdate");
+                    fixedUpdate(dt);
+                }
+                SIMLAB_PROFILE_ZONE("Render");
                 window.clear();
                 Draw(window);
+                drawOverlay();
                 window.display();
             } else {
+                SIMLAB_PROFILE_ZONE("Render");
                 window.clear();
                 physicsManager->withDataLock(
                     [this]() -> void { Draw(window); });
+                drawOverlay();
                 window.display();
             }
         }
@@ -104,6 +121,30 @@ namespace simlab {
         accumulator = std::min(accumulator, m_fixedDeltaTime);
     }
 
+    void Game::drawOverlay() {
+        if (!overlay.isVisible()) {
+            return;
+        }
+        SIMLAB_PROFILE_ZONE("Overlay");
+        if (m_physicsEngine) {
+            overlay.setPhysicsStats(physicsManager->getPerformanceStats());
+        }
+        overlay.setTargetFPS(static_cast<float>(m_frameRate));
+        if (AllocationTracker::isEnabled()) {
+            AllocationTracker::Counts frame = AllocationTracker::getLastFrame();
+            overlay.setCounter("Allocs/frame",
+                               static_cast<double>(frame.allocations));
+            overlay.setCounter("KiB/frame",
+                               static_cast<double>(frame.bytes) / 1024.0);
+        }
+
+        // Pin the panel to the window regardless of the simulation's view
+        sf::View view = window.getView();
+        window.setView(window.getDefaultView());
+        overlay.draw(window);
+        window.setView(view);
+    }
+
     void Game::pollEvents() {
         sf::Event event{};
         while (window.pollEvent(event)) {
@@ -118,6 +159,12 @@ namespace simlab {
                 window.close();
             }
 
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-union-access)
+            if (event.type == sf::Event::KeyPressed &&
+                event.key.code == sf::Keyboard::F3) {
+                overlay.toggle();
+            }
+
             if (m_physicsEngine) {
                 // Forward events safely to physics thread if needed
                 physicsManager->withDataLock(
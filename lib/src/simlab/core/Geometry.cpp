@@ -0,0 +1,32 @@
+#include "simlab/core/Geometry.hpp"
+
+#include <cmath>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+
+namespace simlab {
+
+    auto Geometry::unitCircle(std::size_t segments) -> const UnitCircle& {
+        if (segments < 3) {
+            throw std::logic_error("Geometry: a circle needs 3+ segments");
+        }
+
+        // Map nodes never move, so handed-out references stay valid
+        static std::mutex                        mutex;
+        static std::map<std::size_t, UnitCircle> tables;
+
+        std::scoped_lock lock(mutex);
+        UnitCircle&      unit = tables[segments];
+        if (unit.empty()) {
+            // Same angle arithmetic GenerateCircle always used
+            unit.reserve(segments + 1);
+            for (std::size_t i = 0; i <= segments; i++) {
+                float angle = static_cast<float>(i) * 2.F * M_PI /
+                              static_cast<float>(segments);
+                unit.emplace_back(std::cos(angle), std::sin(angle));
+            }
+        }
+        return unit;
+    }
+}  // namespace simlab
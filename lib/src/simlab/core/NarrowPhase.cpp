@@ -0,0 +1,364 @@
+#include "simlab/core/NarrowPhase.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace simlab {
+
+    namespace {
+
+        using BatchFunction = void (*)(const ColliderSet&,
+                                       const ContactPair*, const ContactPair*,
+                                       std::vector<Contact>&);
+
+        // One tight loop per type pair so the routine can be inlined
+        template <NarrowPhase::PairFunction Function>
+        void runBatch(const ColliderSet& colliders, const ContactPair* begin,
+                      const ContactPair* end, std::vector<Contact>& contacts) {
+            for (const ContactPair* pair = begin; pair != end; ++pair) {
+                CollisionInfo info = Function(colliders, colliders[pair->bodyA],
+                                              colliders[pair->bodyB]);
+                if (info.collided) {
+                    contacts.push_back({*pair, info});
+                }
+            }
+        }
+
+        constexpr auto pairIndex(ColliderType typeA, ColliderType typeB)
+            -> std::size_t {
+            return (static_cast<std::size_t>(typeA) * NarrowPhase::TypeCount) +
+                   static_cast<std::size_t>(typeB);
+        }
+
+        // Upper triangle only; run() orders every pair so typeA <= typeB
+        constexpr std::array<NarrowPhase::PairFunction,
+                             NarrowPhase::TypeCount * NarrowPhase::TypeCount>
+            PairTable = {
+                &NarrowPhase::circleCircle,
+                &NarrowPhase::circleBox,
+                &NarrowPhase::circlePolygon,
+                nullptr,
+                &NarrowPhase::boxBox,
+                &NarrowPhase::polygonPolygon,
+                nullptr,
+                nullptr,
+                &NarrowPhase::polygonPolygon,
+        };
+
+        constexpr std::array<BatchFunction,
+                             NarrowPhase::TypeCount * NarrowPhase::TypeCount>
+            BatchTable = {
+                &runBatch<&NarrowPhase::circleCircle>,
+                &runBatch<&NarrowPhase::circleBox>,
+                &runBatch<&NarrowPhase::circlePolygon>,
+                nullptr,
+                &runBatch<&NarrowPhase::boxBox>,
+                &runBatch<&NarrowPhase::polygonPolygon>,
+                nullptr,
+                nullptr,
+                &runBatch<&NarrowPhase::polygonPolygon>,
+        };
+    }  // namespace
+
+    auto ColliderSet::addCircle(const sf::CircleShape& circle)
+        -> std::uint32_t {
+        return add(ColliderType::Circle, circle);
+    }
+
+    auto ColliderSet::addBox(const sf::RectangleShape& box) -> std::uint32_t {
+        return add(ColliderType::Box, box);
+    }
+
+    auto ColliderSet::addPolygon(const sf::Shape& polygon) -> std::uint32_t {
+        return add(ColliderType::Polygon, polygon);
+    }
+
+    auto ColliderSet::add(ColliderType type, const sf::Shape& shape)
+        -> std::uint32_t {
+        Collider collider;
+        collider.type  = type;
+        collider.shape = &shape;
+        if (type != ColliderType::Circle) {
+            collider.geometry = static_cast<std::uint32_t>(m_geometry.size());
+            m_geometry.emplace_back();
+        }
+
+        auto index = static_cast<std::uint32_t>(m_colliders.size());
+        m_colliders.push_back(collider);
+        update(index);
+        return index;
+    }
+
+    void ColliderSet::update(std::uint32_t index) {
+        Collider& collider = m_colliders[index];
+        switch (collider.type) {
+            case ColliderType::Circle: {
+                const auto* circle =
+                    static_cast<const sf::CircleShape*>(collider.shape);
+                collider.radius = circle->getRadius();
+                collider.center = circle->getTransform().transformPoint(
+                    collider.radius, collider.radius);
+                break;
+            }
+            case ColliderType::Box: {
+                ColliderGeometry& geometry = m_geometry[collider.geometry];
+                if (!geometry.polygon.update(*collider.shape)) {
+                    break;
+                }
+                const sf::Vector2f* verts = geometry.polygon.getVertices();
+                sf::Vector2f        edgeX = verts[1] - verts[0];
+                sf::Vector2f        edgeY = verts[3] - verts[0];
+
+                collider.center      = geometry.polygon.getCentroid();
+                geometry.halfExtents = {utils::magnitude(edgeX) * 0.5F,
+                                        utils::magnitude(edgeY) * 0.5F};
+                geometry.axes = {utils::normalize(edgeX),
+                                 utils::normalize(edgeY)};
+                break;
+            }
+            default: {
+                ColliderGeometry& geometry = m_geometry[collider.geometry];
+                geometry.polygon.update(*collider.shape);
+                collider.center = geometry.polygon.getCentroid();
+                break;
+            }
+        }
+    }
+
+    void ColliderSet::update() {
+        for (std::size_t i = 0; i < m_colliders.size(); i++) {
+            update(static_cast<std::uint32_t>(i));
+        }
+    }
+
+    void ColliderSet::clear() {
+        m_colliders.clear();
+        m_geometry.clear();
+    }
+
+    void NarrowPhase::run(const ColliderSet&              colliders,
+                          const std::vector<ContactPair>& candidates,
+                          std::vector<Contact>&           contacts) {
+        m_batchSizes.fill(0);
+        for (const auto& pair : candidates) {
+            ColliderType typeA = colliders[pair.bodyA].type;
+            ColliderType typeB = colliders[pair.bodyB].type;
+            m_batchSizes[pairIndex(std::min(typeA, typeB),
+                                   std::max(typeA, typeB))]++;
+        }
+
+        std::array<std::size_t, TypeCount * TypeCount> cursor{};
+        for (std::size_t key = 1; key < cursor.size(); key++) {
+            cursor[key] = cursor[key - 1] + m_batchSizes[key - 1];
+        }
+        auto offsets = cursor;
+
+        // Bucket by type pair, cheaper collider first
+        m_sorted.resize(candidates.size());
+        for (ContactPair pair : candidates) {
+            ColliderType typeA = colliders[pair.bodyA].type;
+            ColliderType typeB = colliders[pair.bodyB].type;
+            if (typeA > typeB) {
+                std::swap(pair.bodyA, pair.bodyB);
+                std::swap(typeA, typeB);
+            }
+            m_sorted[cursor[pairIndex(typeA, typeB)]++] = pair;
+        }
+
+        for (std::size_t key = 0; key < BatchTable.size(); key++) {
+            if (m_batchSizes[key] == 0) {
+                continue;
+            }
+            const ContactPair* begin = m_sorted.data() + offsets[key];
+            BatchTable[key](colliders, begin, begin + m_batchSizes[key],
+                            contacts);
+        }
+    }
+
+    auto NarrowPhase::getPairFunction(ColliderType typeA, ColliderType typeB)
+        -> PairFunction {
+        return PairTable[pairIndex(typeA, typeB)];
+    }
+
+    auto NarrowPhase::circleCircle(const ColliderSet& /*set*/,
+                                   const Collider& a, const Collider& b)
+        -> CollisionInfo {
+        CollisionInfo result;
+
+        sf::Vector2f distanceVec = b.center - a.center;
+        float        distanceSq  = utils::magnitudeSquared(distanceVec);
+        float        radiusSum   = a.radius + b.radius;
+
+        if (distanceSq > radiusSum * radiusSum || distanceSq < 1e-6F) {
+            return result;
+        }
+
+        float distance      = std::sqrt(distanceSq);
+        result.collided     = true;
+        result.penetration  = radiusSum - distance;
+        result.normal       = distanceVec / distance;
+        result.magnitude    = distance;
+        result.point        = a.center;
+        result.contactPoint = a.center + (result.normal * a.radius);
+        return result;
+    }
+
+    auto NarrowPhase::circleBox(const ColliderSet& set, const Collider& a,
+                                const Collider& b) -> CollisionInfo {
+        CollisionInfo result;
+
+        const ColliderGeometry& box = set.getGeometry(b);
+
+        // Circle center in the box frame
+        sf::Vector2f local = a.center - b.center;
+        float        lx    = utils::dotProduct(local, box.axes[0]);
+        float        ly    = utils::dotProduct(local, box.axes[1]);
+        float        hx    = box.halfExtents.x;
+        float        hy    = box.halfExtents.y;
+
+        if (std::abs(lx) <= hx && std::abs(ly) <= hy) {
+            // Center inside: leave through the nearest face
+            float penX = hx - std::abs(lx);
+            float penY = hy - std::abs(ly);
+
+            sf::Vector2f outward = penX < penY
+                                       ? box.axes[0] * (lx < 0.F ? -1.F : 1.F)
+                                       : box.axes[1] * (ly < 0.F ? -1.F : 1.F);
+            result.collided     = true;
+            result.normal       = -outward;
+            result.penetration  = a.radius + std::min(penX, penY);
+            result.magnitude    = result.penetration;
+            result.point        = a.center;
+            result.contactPoint = a.center;
+            return result;
+        }
+
+        sf::Vector2f closest = b.center +
+                               (box.axes[0] * std::clamp(lx, -hx, hx)) +
+                               (box.axes[1] * std::clamp(ly, -hy, hy));
+        sf::Vector2f diff       = a.center - closest;
+        float        distanceSq = utils::magnitudeSquared(diff);
+        if (distanceSq > a.radius * a.radius) {
+            return result;
+        }
+
+        float distance      = std::sqrt(distanceSq);
+        result.collided     = true;
+        result.normal       = -diff / distance;
+        result.penetration  = a.radius - distance;
+        result.magnitude    = result.penetration;
+        result.point        = a.center;
+        result.contactPoint = closest;
+        return result;
+    }
+
+    auto NarrowPhase::circlePolygon(const ColliderSet& set, const Collider& a,
+                                    const Collider& b) -> CollisionInfo {
+        CollisionInfo result;
+
+        const PolygonCollider& poly    = set.getGeometry(b).polygon;
+        const sf::Vector2f*    verts   = poly.getVertices();
+        const sf::Vector2f*    normals = poly.getNormals();
+        std::size_t            count   = poly.getVertexCount();
+
+        // Face of maximum separation from the circle center
+        std::size_t face          = 0;
+        float       maxSeparation = -std::numeric_limits<float>::max();
+        for (std::size_t i = 0; i < count; i++) {
+            float separation =
+                utils::dotProduct(normals[i], a.center - verts[i]);
+            if (separation > a.radius) {
+                return result;  // Gap found
+            }
+            if (separation > maxSeparation) {
+                maxSeparation = separation;
+                face          = i;
+            }
+        }
+
+        const sf::Vector2f& v1 = verts[face];
+        const sf::Vector2f& v2 = verts[(face + 1) % count];
+
+        // Outward normal from the polygon towards the circle
+        sf::Vector2f outward  = normals[face];
+        float        distance = maxSeparation;
+        sf::Vector2f closest  = a.center - (outward * maxSeparation);
+
+        if (maxSeparation > 0.F) {
+            // Outside the face: may be nearest to one of its vertices
+            if (utils::dotProduct(a.center - v1, v2 - v1) <= 0.F) {
+                closest = v1;
+            } else if (utils::dotProduct(a.center - v2, v1 - v2) <= 0.F) {
+                closest = v2;
+            }
+            sf::Vector2f diff = a.center - closest;
+            distance          = utils::magnitude(diff);
+            if (distance > a.radius) {
+                return result;
+            }
+            if (distance > 0.F) {
+                outward = diff / distance;
+            }
+        }
+
+        result.collided     = true;
+        result.normal       = -outward;
+        result.penetration  = a.radius - distance;
+        result.magnitude    = result.penetration;
+        result.point        = a.center;
+        result.contactPoint = closest;
+        return result;
+    }
+
+    auto NarrowPhase::boxBox(const ColliderSet& set, const Collider& a,
+                             const Collider& b) -> CollisionInfo {
+        CollisionInfo result;
+
+        const ColliderGeometry& boxA = set.getGeometry(a);
+        const ColliderGeometry& boxB = set.getGeometry(b);
+
+        sf::Vector2f delta      = b.center - a.center;
+        float        minOverlap = std::numeric_limits<float>::max();
+        sf::Vector2f bestAxis;
+
+        // Half-width of a box projected onto axis
+        auto projectedRadius = [](const ColliderGeometry& box,
+                                  const sf::Vector2f&     axis) -> float {
+            return (box.halfExtents.x *
+                    std::abs(utils::dotProduct(box.axes[0], axis))) +
+                   (box.halfExtents.y *
+                    std::abs(utils::dotProduct(box.axes[1], axis)));
+        };
+
+        // Only two unique face axes per box
+        const std::array<sf::Vector2f, 4> testAxes = {
+            boxA.axes[0], boxA.axes[1], boxB.axes[0], boxB.axes[1]};
+        for (const auto& axis : testAxes) {
+            float distance = utils::dotProduct(delta, axis);
+            float overlap  = projectedRadius(boxA, axis) +
+                            projectedRadius(boxB, axis) - std::abs(distance);
+
+            if (overlap < 0.F) {
+                return result;  // Gap found
+            }
+            if (overlap < minOverlap) {
+                minOverlap = overlap;
+                bestAxis   = distance < 0.F ? -axis : axis;
+            }
+        }
+
+        result.collided     = true;
+        result.normal       = bestAxis;
+        result.penetration  = minOverlap;
+        result.magnitude    = minOverlap;
+        result.point        = a.center;
+        result.contactPoint = boxA.polygon.support(bestAxis);
+        return result;
+    }
+
+    auto NarrowPhase::polygonPolygon(const ColliderSet& set, const Collider& a,
+                                     const Collider& b) -> CollisionInfo {
+        return Collision::shapeCollision(set.getGeometry(a).polygon,
+                                         set.getGeometry(b).polygon);
+    }
+}  // namespace simlab
@@ -0,0 +1,116 @@
+#include "simlab/core/Palette.hpp"
+
+#include "simlab/core/utils.hpp"
+
+#include <array>
+#include <stdexcept>
+
+namespace simlab {
+
+    namespace {
+
+        // Indices per pass of map(), kept on the stack
+        constexpr std::size_t Chunk = 256;
+
+        auto mix(sf::Uint8 a, sf::Uint8 b, float t) -> sf::Uint8 {
+            return static_cast<sf::Uint8>(std::lround(a + ((b - a) * t)));
+        }
+    }  // namespace
+
+    Palette::Palette(const std::function<sf::Color(float t)>& color,
+                     std::size_t size, bool periodic)
+        : m_mask(size - 1),
+          m_last(static_cast<float>(size - 1)),
+          m_periodic(periodic) {
+        if (size == 0 || (size & (size - 1)) != 0) {
+            throw std::logic_error("Palette size must be a power of two");
+        }
+        // Each entry is the color at the middle of its bin
+        m_table.resize(size);
+        for (std::size_t i = 0; i < size; i++) {
+            m_table[i] = color((static_cast<float>(i) + 0.5F) /
+                               static_cast<float>(size));
+        }
+    }
+
+    auto Palette::hsv(float saturation, float value, std::size_t size)
+        -> Palette {
+        return {[=](float t) -> sf::Color {
+                    return utils::HSVtoRGB(t, saturation, value);
+                },
+                size, true};
+    }
+
+    auto Palette::hsl(float saturation, float lightness, std::size_t size)
+        -> Palette {
+        return {[=](float t) -> sf::Color {
+                    return utils::HSLtoRGB(t * 360.F, saturation, lightness);
+                },
+                size, true};
+    }
+
+    auto Palette::viridis(std::size_t size) -> Palette {
+        return gradient(
+            {sf::Color(0x44, 0x01, 0x54), sf::Color(0x47, 0x2d, 0x7b),
+             sf::Color(0x3b, 0x52, 0x8b), sf::Color(0x2c, 0x72, 0x8e),
+             sf::Color(0x21, 0x91, 0x8c), sf::Color(0x28, 0xae, 0x80),
+             sf::Color(0x5e, 0xc9, 0x62), sf::Color(0xad, 0xdc, 0x30),
+             sf::Color(0xfd, 0xe7, 0x25)},
+            size);
+    }
+
+    auto Palette::gradient(std::initializer_list<sf::Color> stops,
+                           std::size_t size) -> Palette {
+        if (stops.size() < 2) {
+            throw std::logic_error("Palette gradient needs two or more stops");
+        }
+        std::vector<sf::Color> colors(stops);
+        return {[colors](float t) -> sf::Color {
+                    auto  last     = static_cast<float>(colors.size() - 1);
+                    float position = t * last;
+                    std::size_t segment =
+                        std::min(static_cast<std::size_t>(position),
+                                 colors.size() - 2);
+                    float f = position - static_cast<float>(segment);
+
+                    sf::Color a = colors[segment];
+                    sf::Color b = colors[segment + 1];
+                    return {mix(a.r, b.r, f), mix(a.g, b.g, f),
+                            mix(a.b, b.b, f), mix(a.a, b.a, f)};
+                },
+                size, false};
+    }
+
+    void Palette::map(const float* values, sf::Color* out, std::size_t n,
+                      float lo, float hi) const {
+        const auto  bins  = static_cast<float>(m_table.size());
+        const float scale = hi != lo ? bins / (hi - lo) : 0.F;
+
+        std::array<std::uint32_t, Chunk> indices{};
+        for (std::size_t start = 0; start < n; start += Chunk) {
+            std::size_t  count = std::min(Chunk, n - start);
+            const float* in    = values + start;
+
+            if (m_periodic) {
+                for (std::size_t i = 0; i < count; i++) {
+                    indices[i] = wrapBin((in[i] - lo) * scale);
+                }
+            } else {
+                for (std::size_t i = 0; i < count; i++) {
+                    indices[i] = clampBin((in[i] - lo) * scale);
+                }
+            }
+
+            for (std::size_t i = 0; i < count; i++) {
+                out[start + i] = m_table[indices[i]];
+            }
+        }
+    }
+
+    auto Palette::map(const std::vector<float>& values, float lo,
+                      float hi) const -> std::vector<sf::Color> {
+        std::vector<sf::Color> colors(values.size());
+        map(values.data(), colors.data(), values.size(), lo, hi);
+        return colors;
+    }
+}  // namespace simlab
@@ -0,0 +1,176 @@
+#include "simlab/core/PerfCounters.hpp"
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <cstring>
+
+namespace simlab {
+
+    namespace {
+
+#ifdef __linux__
+        struct CounterConfig {
+            std::uint32_t type;
+            std::uint64_t config;
+        };
+
+        constexpr auto cacheMiss(std::uint64_t cache) -> std::uint64_t {
+            return cache | (PERF_COUNT_HW_CACHE_OP_READ << 8U) |
+                   (PERF_COUNT_HW_CACHE_RESULT_MISS << 16U);
+        }
+
+        constexpr std::array<CounterConfig, PerfCounters::Count> Configs = {{
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+            {PERF_TYPE_HW_CACHE, cacheMiss(PERF_COUNT_HW_CACHE_L1D)},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+        }};
+
+        /**
+         * @brief Counter group of one thread
+         * The first counter that opens leads the group; the rest join it
+         * so one read() returns consistent values for all of them
+         */
+        class ThreadGroup {
+          public:
+
+            ThreadGroup() {
+                m_fds.fill(-1);
+                for (std::size_t i = 0; i < PerfCounters::Count; i++) {
+                    perf_event_attr attr;
+                    std::memset(&attr, 0, sizeof(attr));
+                    attr.size           = sizeof(attr);
+                    attr.type           = Configs[i].type;
+                    attr.config         = Configs[i].config;
+                    attr.exclude_kernel = 1;  // Allowed at paranoid level 2
+                    attr.exclude_hv     = 1;
+                    attr.read_format    = PERF_FORMAT_GROUP | PERF_FORMAT_ID |
+                                       PERF_FORMAT_TOTAL_TIME_ENABLED |
+                                       PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+                    // This thread, any CPU, joined to the leader if any
+                    int fd = static_cast<int>(syscall(
+                        SYS_perf_event_open, &attr, 0, -1, m_leader, 0));
+                    if (fd < 0) {
+                        continue;
+                    }
+                    std::uint64_t id = 0;
+                    if (ioctl(fd, PERF_EVENT_IOC_ID, &id) != 0) {
+                        close(fd);
+                        continue;
+                    }
+                    if (m_leader < 0) {
+                        m_leader = fd;
+                    }
+                    m_fds[i] = fd;
+                    m_ids[i] = id;
+                    m_validMask |= 1U << i;
+                }
+            }
+
+            ThreadGroup(const ThreadGroup&)                    = delete;
+            ThreadGroup(ThreadGroup&&)                         = delete;
+            auto operator=(const ThreadGroup&) -> ThreadGroup& = delete;
+            auto operator=(ThreadGroup&&) -> ThreadGroup&      = delete;
+
+            ~ThreadGroup() {
+                for (int fd : m_fds) {
+                    if (fd >= 0) {
+                        close(fd);
+                    }
+                }
+            }
+
+            auto read() const -> PerfCounters::Sample {
+                PerfCounters::Sample sample;
+                if (m_leader < 0) {
+                    return sample;
+                }
+
+                // nr, time_enabled, time_running, then {value, id} pairs
+                std::array<std::uint64_t, 3 + (2 * PerfCounters::Count)> buf{};
+                if (::read(m_leader, buf.data(), sizeof(buf)) <= 0) {
+                    return sample;
+                }
+                std::uint64_t count   = buf[0];
+                std::uint64_t enabled = buf[1];
+                std::uint64_t running = buf[2];
+
+                // Extrapolate when the kernel multiplexed the group
+                double scale = running != 0 && running < enabled
+                                   ? static_cast<double>(enabled) /
+                                         static_cast<double>(running)
+                                   : 1.0;
+
+                for (std::uint64_t k = 0; k < count; k++) {
+                    std::uint64_t value = buf[3 + (2 * k)];
+                    std::uint64_t id    = buf[4 + (2 * k)];
+                    for (std::size_t i = 0; i < PerfCounters::Count; i++) {
+                        if (m_fds[i] >= 0 && m_ids[i] == id) {
+                            sample.values[i] = static_cast<std::uint64_t>(
+                                static_cast<double>(value) * scale);
+                        }
+                    }
+                }
+                sample.validMask = m_validMask;
+                return sample;
+            }
+
+            auto getValidMask() const -> std::uint32_t {
+                return m_validMask;
+            }
+
+          private:
+
+            std::array<int, PerfCounters::Count>           m_fds{};
+            std::array<std::uint64_t, PerfCounters::Count> m_ids{};
+            int                                            m_leader    = -1;
+            std::uint32_t                                  m_validMask = 0;
+        };
+
+        auto threadGroup() -> const ThreadGroup& {
+            thread_local const ThreadGroup group;
+            return group;
+        }
+#endif
+    }  // namespace
+
+    auto PerfCounters::read() -> Sample {
+#ifdef __linux__
+        return threadGroup().read();
+#else
+        return {};
+#endif
+    }
+
+    auto PerfCounters::isAvailable() -> bool {
+#ifdef __linux__
+        return threadGroup().getValidMask() != 0;
+#else
+        return false;
+#endif
+    }
+
+    auto PerfCounters::getName(Counter counter) -> const char* {
+        switch (counter) {
+            case Cycles:
+                return "cycles";
+            case Instructions:
+                return "instructions";
+            case L1DMisses:
+                return "L1D misses";
+            case LLCMisses:
+                return "LLC misses";
+            case BranchMisses:
+                return "branch misses";
+            default:
+                return "unknown";
+        }
+    }
+}  // namespace simlab
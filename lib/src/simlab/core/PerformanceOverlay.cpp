@@ -0,0 +1,278 @@
+#include "simlab/core/PerformanceOverlay.hpp"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cctype>
+#include <iterator>
+
+namespace simlab {
+
+    namespace {
+
+        struct GlyphBits {
+            char          c;
+            std::uint16_t bits;
+        };
+
+        // Rows top to bottom, three bits per row, MSB on the left
+        constexpr std::array<GlyphBits, 46> Glyphs = {{
+            {'0', 0b111'101'101'101'111},
+            {'1', 0b010'110'010'010'111},
+            {'2', 0b111'001'111'100'111},
+            {'3', 0b111'001'111'001'111},
+            {'4', 0b101'101'111'001'001},
+            {'5', 0b111'100'111'001'111},
+            {'6', 0b111'100'111'101'111},
+            {'7', 0b111'001'001'001'001},
+            {'8', 0b111'101'111'101'111},
+            {'9', 0b111'101'111'001'111},
+            {'A', 0b010'101'111'101'101},
+            {'B', 0b110'101'110'101'110},
+            {'C', 0b011'100'100'100'011},
+            {'D', 0b110'101'101'101'110},
+            {'E', 0b111'100'110'100'111},
+            {'F', 0b111'100'110'100'100},
+            {'G', 0b011'100'101'101'011},
+            {'H', 0b101'101'111'101'101},
+            {'I', 0b111'010'010'010'111},
+            {'J', 0b001'001'001'101'010},
+            {'K', 0b101'101'110'101'101},
+            {'L', 0b100'100'100'100'111},
+            {'M', 0b101'111'111'101'101},
+            {'N', 0b110'101'101'101'101},
+            {'O', 0b010'101'101'101'010},
+            {'P', 0b110'101'110'100'100},
+            {'Q', 0b010'101'101'110'011},
+            {'R', 0b110'101'110'101'101},
+            {'S', 0b011'100'010'001'110},
+            {'T', 0b111'010'010'010'010},
+            {'U', 0b101'101'101'101'111},
+            {'V', 0b101'101'101'101'010},
+            {'W', 0b101'101'111'111'101},
+            {'X', 0b101'101'010'101'101},
+            {'Y', 0b101'101'010'010'010},
+            {'Z', 0b111'001'010'100'111},
+            {'.', 0b000'000'000'000'010},
+            {':', 0b000'010'000'010'000},
+            {'/', 0b001'001'010'100'100},
+            {'-', 0b000'000'111'000'000},
+            {'+', 0b000'010'111'010'000},
+            {'%', 0b101'001'010'100'101},
+            {'(', 0b010'100'100'100'010},
+            {')', 0b010'001'001'001'010},
+            {'_', 0b000'000'000'000'111},
+            {'=', 0b000'111'000'111'000},
+        }};
+
+        // ASCII lookup; characters without a glyph render as blanks
+        constexpr auto buildFont() -> std::array<std::uint16_t, 128> {
+            std::array<std::uint16_t, 128> font{};
+            for (const auto& glyph : Glyphs) {
+                font[static_cast<unsigned char>(glyph.c)] = glyph.bits;
+            }
+            return font;
+        }
+
+        constexpr auto Font = buildFont();
+
+        const sf::Color Background(0, 0, 0, 170);
+        const sf::Color TextColor(230, 230, 230);
+        const sf::Color GoodColor(80, 200, 120);
+        const sf::Color SlowColor(230, 200, 60);
+        const sf::Color BadColor(230, 70, 60);
+        const sf::Color PhysicsColor(70, 170, 240);
+        const sf::Color BudgetColor(255, 255, 255, 120);
+
+        constexpr float Margin      = 8.F;
+        constexpr float GraphHeight = 60.F;
+    }  // namespace
+
+    PerformanceOverlay::PerformanceOverlay() {
+        m_vertices.reserve(8192);
+        m_counters.reserve(8);
+    }
+
+    void PerformanceOverlay::recordFrame(float frameSeconds) {
+        m_frameMs[m_head]   = frameSeconds * 1000.F;
+        m_physicsMs[m_head] = m_hasPhysics ? m_physics.stepTimeMs : 0.F;
+        m_head              = (m_head + 1) % HistoryLength;
+        m_samples           = std::min(m_samples + 1, HistoryLength);
+    }
+
+    void PerformanceOverlay::setPhysicsStats(
+        const PhysicsManager::PerformanceStats& stats) {
+        m_physics    = stats;
+        m_hasPhysics = true;
+    }
+
+    void PerformanceOverlay::setCounter(const std::string& name,
+                                        double             value) {
+        std::scoped_lock lock(m_counterMutex);
+        for (auto& [counterName, counterValue] : m_counters) {
+            if (counterName == name) {
+                counterValue = value;
+                return;
+            }
+        }
+        m_counters.emplace_back(name, value);
+    }
+
+    void PerformanceOverlay::removeCounter(const std::string& name) {
+        std::scoped_lock lock(m_counterMutex);
+        m_counters.erase(
+            std::remove_if(m_counters.begin(), m_counters.end(),
+                           [&name](const auto& counter) -> bool {
+                               return counter.first == name;
+                           }),
+            m_counters.end());
+    }
+
+    void PerformanceOverlay::draw(sf::RenderTarget& target) {
+        if (!m_visible) {
+            return;
+        }
+        auto buildStart = std::chrono::steady_clock::now();
+
+        // Background goes first; its size is known once the text is laid out
+        m_vertices.resize(6);
+
+        const float lineHeight = (GlyphHeight + 2) * m_pixelSize;
+        sf::Vector2f cursor(Margin, Margin);
+
+        auto newest = [this](const std::array<float, HistoryLength>& ring) {
+            return ring[(m_head + HistoryLength - 1) % HistoryLength];
+        };
+        float frameAvg = 0.F;
+        float frameMax = 0.F;
+        for (std::size_t i = 0; i < m_samples; i++) {
+            frameAvg += m_frameMs[i];
+            frameMax = std::max(frameMax, m_frameMs[i]);
+        }
+        frameAvg /= static_cast<float>(std::max<std::size_t>(m_samples, 1));
+
+        auto line = [&](sf::Color color, std::string_view format,
+                        const auto&... args) {
+            m_line.clear();
+            fmt::vformat_to(std::back_inserter(m_line), format,
+                            fmt::make_format_args(args...));
+            appendText(cursor, m_line, color);
+            cursor.y += lineHeight;
+        };
+
+        line(TextColor, "FRAME   {:6.2f} MS  AVG {:6.2f}  MAX {:6.2f}",
+             newest(m_frameMs), frameAvg, frameMax);
+        line(TextColor, "FPS     {:6.1f}     TARGET {:.0f}",
+             frameAvg > 0.F ? 1000.F / frameAvg : 0.F, m_targetFPS);
+        if (m_hasPhysics) {
+            line(PhysicsColor, "PHYSICS {:6.2f} MS  FPS {:.0f}/{:.0f}",
+                 m_physics.stepTimeMs, m_physics.actualFPS,
+                 m_physics.targetFPS);
+        }
+        {
+            std::scoped_lock lock(m_counterMutex);
+            for (const auto& [name, value] : m_counters) {
+                line(TextColor, "{} {:g}", name, value);
+            }
+        }
+        line(TextColor, "OVERLAY {:6.3f} MS",
+             std::chrono::duration<float, std::milli>(m_buildTime).count());
+
+        cursor.y += m_pixelSize;
+        sf::Vector2f graphSize(static_cast<float>(HistoryLength), GraphHeight);
+        appendGraph(cursor, graphSize);
+
+        // Widest line decides the panel width
+        float right = Margin + graphSize.x;
+        for (std::size_t i = 6; i < m_vertices.size(); i++) {
+            right = std::max(right, m_vertices[i].position.x);
+        }
+        float bottom = cursor.y + graphSize.y + Margin;
+
+        std::array<sf::Vector2f, 4> corners = {
+            sf::Vector2f(0.F, 0.F), sf::Vector2f(right + Margin, 0.F),
+            sf::Vector2f(right + Margin, bottom), sf::Vector2f(0.F, bottom)};
+        const std::array<int, 6> order = {0, 1, 2, 0, 2, 3};
+        for (std::size_t i = 0; i < order.size(); i++) {
+            m_vertices[i] = sf::Vertex(corners[order[i]], Background);
+        }
+
+        target.draw(m_vertices.data(), m_vertices.size(), sf::Triangles);
+        m_buildTime = std::chrono::steady_clock::now() - buildStart;
+    }
+
+    void PerformanceOverlay::appendQuad(float left, float top, float width,
+                                        float height, sf::Color color) {
+        sf::Vector2f a(left, top);
+        sf::Vector2f b(left + width, top);
+        sf::Vector2f c(left + width, top + height);
+        sf::Vector2f d(left, top + height);
+
+        m_vertices.emplace_back(a, color);
+        m_vertices.emplace_back(b, color);
+        m_vertices.emplace_back(c, color);
+        m_vertices.emplace_back(a, color);
+        m_vertices.emplace_back(c, color);
+        m_vertices.emplace_back(d, color);
+    }
+
+    void PerformanceOverlay::appendText(sf::Vector2f     position,
+                                        std::string_view text,
+                                        sf::Color        color) {
+        const float advance = (GlyphWidth + 1) * m_pixelSize;
+
+        for (char c : text) {
+            auto          code = static_cast<unsigned char>(std::toupper(
+                static_cast<unsigned char>(c)));
+            std::uint16_t bits = code < Font.size() ? Font[code] : 0;
+            for (int row = 0; row < GlyphHeight; row++) {
+                for (int col = 0; col < GlyphWidth; col++) {
+                    int bit = ((GlyphHeight - 1 - row) * GlyphWidth) +
+                              (GlyphWidth - 1 - col);
+                    if (((bits >> bit) & 1U) != 0) {
+                        appendQuad(position.x + (col * m_pixelSize),
+                                   position.y + (row * m_pixelSize),
+                                   m_pixelSize, m_pixelSize, color);
+                    }
+                }
+            }
+            position.x += advance;
+        }
+    }
+
+    void PerformanceOverlay::appendGraph(sf::Vector2f position,
+                                         sf::Vector2f size) {
+        const float budget = 1000.F / std::max(m_targetFPS, 1.F);
+
+        // Fixed scale of two frame budgets unless a spike needs more
+        float scale = 2.F * budget;
+        for (std::size_t i = 0; i < m_samples; i++) {
+            scale = std::max(scale, m_frameMs[i]);
+        }
+        const float pixelsPerMs = size.y / scale;
+        const float bottom      = position.y + size.y;
+
+        // Oldest sample on the left
+        std::size_t first  = (m_head + HistoryLength - m_samples);
+        float       offset = static_cast<float>(HistoryLength - m_samples);
+        for (std::size_t k = 0; k < m_samples; k++) {
+            std::size_t index = (first + k) % HistoryLength;
+            float       x     = position.x + offset + static_cast<float>(k);
+
+            float     frame = m_frameMs[index];
+            sf::Color color = frame <= budget         ? GoodColor
+                              : frame <= 2.F * budget ? SlowColor
+                                                      : BadColor;
+            float     height = frame * pixelsPerMs;
+            appendQuad(x, bottom - height, 1.F, height, color);
+
+            float physics = m_physicsMs[index] * pixelsPerMs;
+            if (physics > 0.F) {
+                appendQuad(x, bottom - physics, 1.F, physics, PhysicsColor);
+            }
+        }
+
+        appendQuad(position.x, bottom - (budget * pixelsPerMs), size.x, 1.F,
+                   BudgetColor);
+    }
+}  // namespace simlab
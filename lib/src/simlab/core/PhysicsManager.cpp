@@ -1,5 +1,7 @@
 #include "simlab/core/PhysicsManager.hpp"
 
+#include "simlab/core/Profiler.hpp"
+
 namespace simlab {
 
     PhysicsManager::PhysicsManager() : m_fixedDeltaTime(1.0F / m_targetFPS) {}
@@ -112,6 +114,7 @@ namespace simlab {
             if (std::chrono::steady_clock::now() - startTime > timeout) {
                 break;
             }
+            SIMLAB_PROFILE_ZONE("Sleep");
             std::this_thread::sleep_for(1ms);
         }
     }
@@ -142,18 +145,21 @@ namespace simlab {
     }
 
     auto PhysicsManager::getPerformanceStats() const -> PerformanceStats {
-        return {getActualFPS(), getTargetFPS(), getTotalUpdates(),
-                getState(),     m_maxDeltaTime, m_maxSubSteps};
+        return {getActualFPS(), getTargetFPS(),  getTotalUpdates(),
+                getState(),     m_maxDeltaTime, m_maxSubSteps,
+                getStepTimeMs()};
     }
 
     void PhysicsManager::physicsLoop() {
         Benchmark bm("Physics Loop");
+        SIMLAB_PROFILE_THREAD("Physics");
 
         auto     lastFPSTime  = std::chrono::steady_clock::now();
         uint64_t framesForFPS = 0;
 
         while (m_state != ThreadState::STOPPED) {
             Benchmark::Scope scope(bm);
+            SIMLAB_PROFILE_ZONE("PhysicsLoop");
 
             // Handle pause
             {
@@ -194,6 +200,7 @@ namespace simlab {
                 lastFPSTime  = currentTime;
             }
 
+            SIMLAB_PROFILE_ZONE("Sleep");
             std::this_thread::sleep_for(1ms);
         }
     }
@@ -222,6 +229,9 @@ namespace simlab {
     }
 
     void PhysicsManager::executePhysicsUpdate(float deltaTime) {
+        SIMLAB_PROFILE_FUNCTION();
+        auto stepStart = std::chrono::steady_clock::now();
+
         // Execute queued tasks safely
         {
             std::scoped_lock lock(m_taskMutex);
@@ -239,6 +249,7 @@ namespace simlab {
 
         // Main physics function - PASSES MUTEX REFERENCE
         if (m_physicsFunction) {
+            SIMLAB_PROFILE_ZONE("PhysicsFunction");
             m_physicsFunction(deltaTime, m_sharedDataMutex);
         }
 
@@ -247,6 +258,9 @@ namespace simlab {
             m_postPhysicsCallback(m_sharedDataMutex);
         }
 
+        m_stepTimeMs = std::chrono::duration<float, std::milli>(
+                           std::chrono::steady_clock::now() - stepStart)
+                           .count();
         m_totalUpdates++;
     }
 }  // namespace simlab
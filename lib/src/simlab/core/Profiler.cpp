@@ -0,0 +1,244 @@
+#include "simlab/core/Profiler.hpp"
+
+#include "simlab/core/AllocationTracker.hpp"
+
+#include <fmt/core.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+namespace simlab {
+
+    namespace {
+
+        using SteadyClock = std::chrono::steady_clock;
+
+        using BufferList =
+            std::vector<std::shared_ptr<Profiler::ThreadBuffer>>;
+
+        void writeTrace(const std::string& path, const BufferList& buffers);
+
+        struct Registry {
+            std::mutex              mutex;
+            BufferList              buffers;
+            SteadyClock::time_point epoch = SteadyClock::now();
+
+            Registry()                                   = default;
+            Registry(const Registry&)                    = delete;
+            Registry(Registry&&)                         = delete;
+            auto operator=(const Registry&) -> Registry& = delete;
+            auto operator=(Registry&&) -> Registry&      = delete;
+
+            ~Registry() {
+                const char* path = std::getenv("SIMLAB_TRACE_EXPORT");
+                if (path == nullptr || *path == '\0') {
+                    return;
+                }
+                try {
+                    writeTrace(path, buffers);
+                } catch (const std::exception& e) {
+                    fmt::print(stderr, "Trace export failed: {}\n", e.what());
+                }
+            }
+        };
+
+        auto registry() -> Registry& {
+            static Registry instance;
+            return instance;
+        }
+
+        // Shared with the registry so events outlive their thread; created
+        // by the thread's first recorded event
+        thread_local std::shared_ptr<Profiler::ThreadBuffer> t_buffer;
+
+        // Name given before the thread had a buffer
+        thread_local std::string t_threadName;
+
+        auto nowNs() -> std::uint64_t {
+            return static_cast<std::uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    SteadyClock::now() - registry().epoch)
+                    .count());
+        }
+
+        auto escapeJson(const std::string& text) -> std::string {
+            std::string escaped;
+            escaped.reserve(text.size());
+            for (char c : text) {
+                if (c == '"' || c == '\\') {
+                    escaped += '\\';
+                }
+                if (static_cast<unsigned char>(c) >= 0x20) {
+                    escaped += c;
+                }
+            }
+            return escaped;
+        }
+
+        void writeTrace(const std::string& path, const BufferList& buffers) {
+            std::ofstream file(path, std::ios::out | std::ios::trunc);
+            if (!file.is_open()) {
+                throw std::runtime_error("Failed to open trace export: " +
+                                         path);
+            }
+
+            file << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n";
+            bool first = true;
+            for (const auto& buffer : buffers) {
+                file << (first ? "" : ",\n")
+                     << fmt::format(
+                            "{{\"name\": \"thread_name\", \"ph\": \"M\", "
+                            "\"pid\": 1, \"tid\": {}, "
+                            "\"args\": {{\"name\": \"{}\"}}}}",
+                            buffer->getThreadId(),
+                            escapeJson(buffer->getThreadName()));
+                first = false;
+
+                // Open zones, so End events can report what the zone allocated
+                std::vector<const Profiler::Event*> open;
+
+                std::size_t count = buffer->size();
+                for (std::size_t i = 0; i < count; i++) {
+                    const auto& event = buffer->at(i);
+                    bool begin = event.type == Profiler::EventType::Begin;
+                    file << fmt::format(
+                        ",\n{{\"name\": \"{}\", \"ph\": \"{}\", "
+                        "\"ts\": {:.3f}, \"pid\": 1, \"tid\": {}",
+                        escapeJson(event.name), begin ? 'B' : 'E',
+                        static_cast<double>(event.timestamp) / 1000.0,
+                        buffer->getThreadId());
+
+                    if (begin) {
+                        open.push_back(&event);
+                    } else if (!open.empty()) {
+                        const Profiler::Event* start = open.back();
+                        open.pop_back();
+                        if (AllocationTracker::isEnabled()) {
+                            file << fmt::format(
+                                ", \"args\": {{\"allocations\": {}, "
+                                "\"bytes\": {}}}",
+                                event.allocations - start->allocations,
+                                event.bytes - start->bytes);
+                        }
+                    }
+                    file << '}';
+                }
+            }
+            file << "\n]}\n";
+        }
+
+        // Start recording right away when a trace export is requested
+        const bool StartedFromEnvironment = []() -> bool {
+            const char* path = std::getenv("SIMLAB_TRACE_EXPORT");
+            if (path == nullptr || *path == '\0') {
+                return false;
+            }
+            Profiler::start();
+            return true;
+        }();
+    }  // namespace
+
+    Profiler::ThreadBuffer::ThreadBuffer(std::uint32_t threadId,
+                                         std::string   threadName)
+        : m_threadId(threadId), m_threadName(std::move(threadName)) {}
+
+    Profiler::ThreadBuffer::~ThreadBuffer() {
+        for (auto& chunk : m_chunks) {
+            delete[] chunk.load(std::memory_order_relaxed);
+        }
+    }
+
+    void Profiler::ThreadBuffer::push(const char* name, EventType type) {
+        // Only the owning thread writes, so a relaxed load is enough here
+        std::size_t index = m_size.load(std::memory_order_relaxed);
+        if (index >= ChunkSize * MaxChunks) {
+            m_dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        // Keep the profiler's own chunk allocation outside the zone
+        AllocationTracker::Counts heap = AllocationTracker::thread();
+
+        std::atomic<Event*>& slot  = m_chunks[index / ChunkSize];
+        Event*               chunk = slot.load(std::memory_order_relaxed);
+        if (chunk == nullptr) {
+            chunk = new Event[ChunkSize];
+            slot.store(chunk, std::memory_order_relaxed);
+            if (type == EventType::Begin) {
+                heap = AllocationTracker::thread();
+            }
+        }
+        chunk[index % ChunkSize] = {name, nowNs(), heap.allocations,
+                                    heap.bytes, type};
+
+        // Publishes the event (and a fresh chunk) to exportTrace()
+        m_size.store(index + 1, std::memory_order_release);
+    }
+
+    auto Profiler::ThreadBuffer::getThreadName() const -> std::string {
+        std::scoped_lock lock(m_nameMutex);
+        return m_threadName;
+    }
+
+    void Profiler::ThreadBuffer::setThreadName(std::string name) {
+        std::scoped_lock lock(m_nameMutex);
+        m_threadName = std::move(name);
+    }
+
+    void Profiler::start() {
+        registry();  // Fix the epoch before the first event
+        s_enabled.store(true, std::memory_order_relaxed);
+    }
+
+    void Profiler::stop() {
+        s_enabled.store(false, std::memory_order_relaxed);
+    }
+
+    void Profiler::setThreadName(const std::string& name) {
+        // Threads that never record while profiling is on get no buffer
+        if (t_buffer == nullptr && !isEnabled()) {
+            t_threadName = name;
+            return;
+        }
+        threadBuffer().setThreadName(name);
+    }
+
+    auto Profiler::threadBuffer() -> ThreadBuffer& {
+        if (t_buffer == nullptr) {
+            Registry&        reg = registry();
+            std::scoped_lock lock(reg.mutex);
+
+            auto threadId = static_cast<std::uint32_t>(reg.buffers.size() + 1);
+            auto name     = t_threadName.empty()
+                                ? fmt::format("Thread {}", threadId)
+                                : std::move(t_threadName);
+            t_buffer =
+                std::make_shared<ThreadBuffer>(threadId, std::move(name));
+            reg.buffers.push_back(t_buffer);
+        }
+        return *t_buffer;
+    }
+
+    void Profiler::exportTrace(const std::string& path) {
+        Registry&        reg = registry();
+        std::scoped_lock lock(reg.mutex);
+        writeTrace(path, reg.buffers);
+    }
+
+    auto Profiler::getDroppedCount() -> std::uint64_t {
+        Registry&        reg = registry();
+        std::scoped_lock lock(reg.mutex);
+
+        std::uint64_t dropped = 0;
+        for (const auto& buffer : reg.buffers) {
+            dropped += buffer->getDropped();
+        }
+        return dropped;
+    }
+}  // namespace simlab
@@ -0,0 +1,197 @@
+#include "simlab/core/Random.hpp"
+
+#include "simlab/core/FastMath.hpp"
+
+#include <fmt/core.h>
+
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <mutex>
+#include <random>
+
+namespace simlab {
+
+    namespace {
+
+        constexpr float         TwoPi  = 2.F * fastmath::Pi;
+        constexpr std::uint64_t Golden = 0x9e3779b97f4a7c15ULL;
+
+        // Expands one seed into well-mixed state words (Vigna)
+        auto splitmix64(std::uint64_t& x) -> std::uint64_t {
+            std::uint64_t z = (x += Golden);
+            z               = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+            z               = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+            return z ^ (z >> 31);
+        }
+
+        std::once_flag             seedOnce;
+        std::atomic<std::uint64_t> globalSeed{0};
+        std::atomic<std::uint64_t> seedGeneration{0};
+        std::atomic<std::uint64_t> nextThreadStream{0};
+
+        // SIMLAB_SEED=<integer> pins every run to the same sequences
+        void initGlobalSeed() {
+            std::call_once(seedOnce, [] {
+                const char* env = std::getenv("SIMLAB_SEED");
+                if (env != nullptr) {
+                    char* end  = nullptr;
+                    auto  seed = std::strtoull(env, &end, 0);
+                    if (end != env && *end == '\0') {
+                        globalSeed = seed;
+                        return;
+                    }
+                    fmt::print(stderr,
+                               "SIMLAB_SEED='{}' is not an integer; "
+                               "seeding randomly\n",
+                               env);
+                }
+                std::random_device device;
+                globalSeed = (static_cast<std::uint64_t>(device()) << 32) |
+                             device();
+            });
+        }
+    }  // namespace
+
+    Random::Random(std::uint64_t seed) {
+        for (auto& word : m_state) {
+            word = splitmix64(seed);
+        }
+    }
+
+    auto Random::uniformInt(int lo, int hi) -> int {
+        // Lemire's multiply-shift, rejecting the few biased products
+        auto span = static_cast<std::uint64_t>(
+                        static_cast<std::int64_t>(hi) - lo) +
+                    1;
+        if (span > std::numeric_limits<std::uint32_t>::max()) {
+            return static_cast<int>(static_cast<std::int64_t>(lo) +
+                                    static_cast<std::int64_t>(
+                                        (*this)() % span));
+        }
+        auto          range   = static_cast<std::uint32_t>(span);
+        std::uint64_t product = ((*this)() >> 32) * range;
+        auto          low     = static_cast<std::uint32_t>(product);
+        if (low < range) {
+            std::uint32_t threshold = (0U - range) % range;
+            while (low < threshold) {
+                product = ((*this)() >> 32) * range;
+                low     = static_cast<std::uint32_t>(product);
+            }
+        }
+        return static_cast<int>(static_cast<std::int64_t>(lo) +
+                                static_cast<std::int64_t>(product >> 32));
+    }
+
+    auto Random::angle() -> float {
+        return nextFloat() * TwoPi;
+    }
+
+    auto Random::normal(float mean, float stddev) -> float {
+        if (m_hasSpare) {
+            m_hasSpare = false;
+            return mean + (stddev * m_spare);
+        }
+        float z0 = 0.F;
+        fillNormal(&z0, 1);
+        return mean + (stddev * z0);
+    }
+
+    void Random::fillUniform(float* out, std::size_t n, float lo, float hi) {
+        const float scale = (hi - lo) * 0x1.0p-24F;
+        for (std::size_t i = 0; i < n; i++) {
+            out[i] = lo + (static_cast<float>((*this)() >> 40) * scale);
+        }
+    }
+
+    void Random::fillNormal(float* out, std::size_t n, float mean,
+                            float stddev) {
+        // Box-Muller: two uniforms in, two normals out
+        std::size_t i = 0;
+        while (i < n) {
+            std::uint64_t bits = (*this)();
+            // (0, 1], so the log is finite
+            float u1 = static_cast<float>((bits >> 40) + 1) * 0x1.0p-24F;
+            float u2 = static_cast<float>((bits >> 16) & 0xffffffU) *
+                       0x1.0p-24F;
+
+            float r  = std::sqrt(-2.F * std::log(u1));
+            float sn = 0.F;
+            float cs = 0.F;
+            math::sincos(u2 * TwoPi, sn, cs);
+
+            out[i++] = mean + (stddev * r * cs);
+            if (i < n) {
+                out[i++] = mean + (stddev * r * sn);
+            } else if (n == 1) {
+                // Single draws through normal() keep the other half
+                m_spare    = r * sn;
+                m_hasSpare = true;
+            }
+        }
+    }
+
+    void Random::fillAngle(float* out, std::size_t n) {
+        fillUniform(out, n, 0.F, TwoPi);
+    }
+
+    auto Random::split() -> Random {
+        Random child(*this);
+        child.m_hasSpare = false;
+        jump();
+        return child;
+    }
+
+    void Random::jump() {
+        // Equivalent to 2^128 calls (xoshiro256 reference jump polynomial)
+        static constexpr std::array<result_type, 4> Jump = {
+            0x180ec6d33cfd0abaULL, 0xd5a61266f0c9392cULL,
+            0xa9582618e03fc9aaULL, 0x39abdc4529b1661cULL};
+
+        std::array<result_type, 4> state{};
+        for (result_type word : Jump) {
+            for (int bit = 0; bit < 64; bit++) {
+                if ((word & (result_type{1} << bit)) != 0) {
+                    for (std::size_t i = 0; i < state.size(); i++) {
+                        state[i] ^= m_state[i];
+                    }
+                }
+                (*this)();
+            }
+        }
+        m_state = state;
+    }
+
+    void Random::setGlobalSeed(std::uint64_t seed) {
+        initGlobalSeed();
+        globalSeed       = seed;
+        nextThreadStream = 0;
+        seedGeneration.fetch_add(1);
+    }
+
+    auto Random::getGlobalSeed() -> std::uint64_t {
+        initGlobalSeed();
+        return globalSeed;
+    }
+
+    auto Random::stream(std::uint64_t index) -> Random {
+        // Hashed, so neighbouring indices share no state words
+        std::uint64_t x = getGlobalSeed() + (index * Golden);
+        return Random(splitmix64(x));
+    }
+
+    auto Random::threadLocal() -> Random& {
+        struct Slot {
+            Random        random{0};
+            std::uint64_t generation = ~std::uint64_t{0};
+        };
+        thread_local Slot slot;
+
+        std::uint64_t generation = seedGeneration.load();
+        if (slot.generation != generation) {
+            slot.random     = stream(nextThreadStream.fetch_add(1));
+            slot.generation = generation;
+        }
+        return slot.random;
+    }
+}  // namespace simlab
@@ -0,0 +1,316 @@
+#include "simlab/core/SignedDistanceField.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace simlab {
+
+    SignedDistanceField::SignedDistanceField(Vec2f origin, Vec2f size,
+                                             float cellSize) {
+        reset(origin, size, cellSize);
+    }
+
+    void SignedDistanceField::reset(Vec2f origin, Vec2f size,
+                                    float cellSize) {
+        if (cellSize <= 0.F) {
+            throw std::invalid_argument(
+                "SignedDistanceField: cellSize must be positive");
+        }
+        m_origin      = origin;
+        m_size        = size;
+        m_cellSize    = cellSize;
+        m_invCellSize = 1.F / cellSize;
+        m_cols = std::max(1, static_cast<int>(std::ceil(size.x / cellSize)));
+        m_rows = std::max(1, static_cast<int>(std::ceil(size.y / cellSize)));
+        clear();
+    }
+
+    void SignedDistanceField::clear() {
+        std::size_t cells = static_cast<std::size_t>(m_cols) * m_rows;
+        m_solid.assign(cells, 0);
+        m_distance.assign(cells, std::numeric_limits<float>::max());
+    }
+
+    void SignedDistanceField::addRectangle(Vec2f position, Vec2f size) {
+        Vec2f first = toGrid(position);
+        Vec2f last  = toGrid(position + size);
+
+        int col0 = std::max(0, static_cast<int>(std::ceil(first.x)));
+        int row0 = std::max(0, static_cast<int>(std::ceil(first.y)));
+        int col1 = std::min(m_cols - 1, static_cast<int>(std::floor(last.x)));
+        int row1 = std::min(m_rows - 1, static_cast<int>(std::floor(last.y)));
+
+        for (int row = row0; row <= row1; row++) {
+            for (int col = col0; col <= col1; col++) {
+                m_solid[index(col, row)] = 1;
+            }
+        }
+    }
+
+    void SignedDistanceField::addPolygon(const std::vector<Vec2f>& points,
+                                         const Mat3&               transform) {
+        if (points.size() < 3) {
+            return;
+        }
+
+        std::vector<Vec2f> world;
+        world.reserve(points.size());
+        for (const auto& point : points) {
+            world.push_back(transform.transformPoint(point));
+        }
+
+        Vec2f minPoint = world[0];
+        Vec2f maxPoint = world[0];
+        for (const auto& point : world) {
+            minPoint.x = std::min(minPoint.x, point.x);
+            minPoint.y = std::min(minPoint.y, point.y);
+            maxPoint.x = std::max(maxPoint.x, point.x);
+            maxPoint.y = std::max(maxPoint.y, point.y);
+        }
+
+        Vec2f first = toGrid(minPoint);
+        Vec2f last  = toGrid(maxPoint);
+
+        int col0 = std::max(0, static_cast<int>(std::ceil(first.x)));
+        int row0 = std::max(0, static_cast<int>(std::ceil(first.y)));
+        int col1 = std::min(m_cols - 1, static_cast<int>(std::floor(last.x)));
+        int row1 = std::min(m_rows - 1, static_cast<int>(std::floor(last.y)));
+
+        for (int row = row0; row <= row1; row++) {
+            for (int col = col0; col <= col1; col++) {
+                Vec2f center = cellCenter(col, row);
+
+                // Even-odd crossing test
+                bool inside = false;
+                for (size_t i = 0, j = world.size() - 1; i < world.size();
+                     j = i++) {
+                    const auto& pi = world[i];
+                    const auto& pj = world[j];
+                    if ((pi.y > center.y) != (pj.y > center.y) &&
+                        center.x < ((pj.x - pi.x) * (center.y - pi.y) /
+                                    (pj.y - pi.y)) +
+                                       pi.x) {
+                        inside = !inside;
+                    }
+                }
+                if (inside) {
+                    m_solid[index(col, row)] = 1;
+                }
+            }
+        }
+    }
+
+    void SignedDistanceField::addMask(const std::vector<std::uint8_t>& mask,
+                                      int width, int height, Vec2f position) {
+        if (width < 0 || height < 0 ||
+            mask.size() < static_cast<std::size_t>(width) * height) {
+            throw std::invalid_argument(
+                "SignedDistanceField: mask smaller than width * height");
+        }
+
+        for (int row = 0; row < m_rows; row++) {
+            for (int col = 0; col < m_cols; col++) {
+                Vec2f pixel = cellCenter(col, row) - position;
+                if (pixel.x < 0.F || pixel.y < 0.F ||
+                    pixel.x >= static_cast<float>(width) ||
+                    pixel.y >= static_cast<float>(height)) {
+                    continue;
+                }
+                auto x = static_cast<std::size_t>(pixel.x);
+                auto y = static_cast<std::size_t>(pixel.y);
+                if (mask[(y * width) + x] != 0) {
+                    m_solid[index(col, row)] = 1;
+                }
+            }
+        }
+    }
+
+    void SignedDistanceField::addFrame(float thickness) {
+        Vec2f far = m_origin + m_size - Vec2f(thickness, thickness);
+
+        addRectangle(m_origin, {m_size.x, thickness});
+        addRectangle({m_origin.x, far.y}, {m_size.x, thickness});
+        addRectangle(m_origin, {thickness, m_size.y});
+        addRectangle({far.x, m_origin.y}, {thickness, m_size.y});
+    }
+
+    void SignedDistanceField::setCell(int col, int row, bool solid) {
+        m_solid[index(col, row)] = solid ? 1 : 0;
+    }
+
+    void SignedDistanceField::build() {
+        buildWith([this](const ThreadPool::RangeFunction& kernel) -> void {
+            kernel(0, static_cast<std::size_t>(m_rows));
+        });
+    }
+
+    void SignedDistanceField::build(ThreadPool& pool) {
+        buildWith([this, &pool](const ThreadPool::RangeFunction& kernel)
+                      -> void {
+            pool.parallelFor(static_cast<std::size_t>(m_rows), kernel, 8);
+        });
+    }
+
+    void SignedDistanceField::buildWith(const RowRunner& forRows) {
+        jumpFlood(true, m_nearestSolid, forRows);
+        jumpFlood(false, m_nearestEmpty, forRows);
+
+        // With no seed of one kind, anything beyond the diagonal is "far"
+        const float far = m_size.length();
+
+        forRows([&](std::size_t rowBegin, std::size_t rowEnd) -> void {
+            for (auto row = static_cast<int>(rowBegin);
+                 row < static_cast<int>(rowEnd); row++) {
+                for (int col = 0; col < m_cols; col++) {
+                    std::size_t  cell    = index(col, row);
+                    bool         solid   = m_solid[cell] != 0;
+                    std::int32_t nearest = solid ? m_nearestEmpty[cell]
+                                                 : m_nearestSolid[cell];
+                    if (nearest < 0) {
+                        m_distance[cell] = solid ? -far : far;
+                        continue;
+                    }
+
+                    float dx = static_cast<float>((nearest % m_cols) - col);
+                    float dy = static_cast<float>((nearest / m_cols) - row);
+
+                    // The surface lies half a cell from the nearest seed
+                    float cells = std::sqrt((dx * dx) + (dy * dy)) - 0.5F;
+                    m_distance[cell] = (solid ? -cells : cells) * m_cellSize;
+                }
+            }
+        });
+    }
+
+    void SignedDistanceField::jumpFlood(bool                       seedSolid,
+                                        std::vector<std::int32_t>& nearest,
+                                        const RowRunner&           forRows) {
+        const std::size_t cells = m_solid.size();
+        nearest.resize(cells);
+        m_scratch.resize(cells);
+
+        for (std::size_t cell = 0; cell < cells; cell++) {
+            nearest[cell] = (m_solid[cell] != 0) == seedSolid
+                                ? static_cast<std::int32_t>(cell)
+                                : -1;
+        }
+
+        int step = 1;
+        while (step * 2 < std::max(m_cols, m_rows)) {
+            step *= 2;
+        }
+
+        // Halving steps, then one extra unit step (JFA+1) to fix the few
+        // cells plain JFA gets wrong
+        bool extraPass = true;
+        while (step >= 1) {
+            const std::vector<std::int32_t>& src = nearest;
+            std::vector<std::int32_t>&       dst = m_scratch;
+
+            forRows([&](std::size_t rowBegin, std::size_t rowEnd) -> void {
+                for (auto row = static_cast<int>(rowBegin);
+                     row < static_cast<int>(rowEnd); row++) {
+                    for (int col = 0; col < m_cols; col++) {
+                        std::int32_t best     = src[index(col, row)];
+                        int          bestDist = std::numeric_limits<int>::max();
+                        if (best >= 0) {
+                            int dx   = (best % m_cols) - col;
+                            int dy   = (best / m_cols) - row;
+                            bestDist = (dx * dx) + (dy * dy);
+                        }
+
+                        for (int oy = -step; oy <= step; oy += step) {
+                            int ny = row + oy;
+                            if (ny < 0 || ny >= m_rows) {
+                                continue;
+                            }
+                            for (int ox = -step; ox <= step; ox += step) {
+                                int nx = col + ox;
+                                if (nx < 0 || nx >= m_cols ||
+                                    (ox == 0 && oy == 0)) {
+                                    continue;
+                                }
+                                std::int32_t seed = src[index(nx, ny)];
+                                if (seed < 0) {
+                                    continue;
+                                }
+                                int dx   = (seed % m_cols) - col;
+                                int dy   = (seed / m_cols) - row;
+                                int dist = (dx * dx) + (dy * dy);
+                                if (dist < bestDist) {
+                                    bestDist = dist;
+                                    best     = seed;
+                                }
+                            }
+                        }
+                        dst[index(col, row)] = best;
+                    }
+                }
+            });
+
+            nearest.swap(m_scratch);
+
+            if (step == 1 && extraPass) {
+                extraPass = false;
+                continue;
+            }
+            step /= 2;
+        }
+    }
+
+    auto SignedDistanceField::toGrid(Vec2f position) const -> Vec2f {
+        return {((position.x - m_origin.x) * m_invCellSize) - 0.5F,
+                ((position.y - m_origin.y) * m_invCellSize) - 0.5F};
+    }
+
+    auto SignedDistanceField::sample(Vec2f position) const -> float {
+        Vec2f grid = toGrid(position);
+        float maxX = static_cast<float>(m_cols - 1);
+        float maxY = static_cast<float>(m_rows - 1);
+        float gx   = std::clamp(grid.x, 0.F, maxX);
+        float gy   = std::clamp(grid.y, 0.F, maxY);
+
+        int   x0 = static_cast<int>(gx);
+        int   y0 = static_cast<int>(gy);
+        int   x1 = std::min(x0 + 1, m_cols - 1);
+        int   y1 = std::min(y0 + 1, m_rows - 1);
+        float fx = gx - static_cast<float>(x0);
+        float fy = gy - static_cast<float>(y0);
+
+        float d00 = m_distance[index(x0, y0)];
+        float d10 = m_distance[index(x1, y0)];
+        float d01 = m_distance[index(x0, y1)];
+        float d11 = m_distance[index(x1, y1)];
+
+        float top    = d00 + ((d10 - d00) * fx);
+        float bottom = d01 + ((d11 - d01) * fx);
+        return top + ((bottom - top) * fy);
+    }
+
+    auto SignedDistanceField::gradient(Vec2f position) const -> Vec2f {
+        Vec2f grid = toGrid(position);
+        float maxX = static_cast<float>(m_cols - 1);
+        float maxY = static_cast<float>(m_rows - 1);
+        float gx   = std::clamp(grid.x, 0.F, maxX);
+        float gy   = std::clamp(grid.y, 0.F, maxY);
+
+        int   x0 = std::min(static_cast<int>(gx), std::max(m_cols - 2, 0));
+        int   y0 = std::min(static_cast<int>(gy), std::max(m_rows - 2, 0));
+        int   x1 = std::min(x0 + 1, m_cols - 1);
+        int   y1 = std::min(y0 + 1, m_rows - 1);
+        float fx = std::clamp(gx - static_cast<float>(x0), 0.F, 1.F);
+        float fy = std::clamp(gy - static_cast<float>(y0), 0.F, 1.F);
+
+        float d00 = m_distance[index(x0, y0)];
+        float d10 = m_distance[index(x1, y0)];
+        float d01 = m_distance[index(x0, y1)];
+        float d11 = m_distance[index(x1, y1)];
+
+        // Analytic derivative of the bilinear patch
+        Vec2f grad(((d10 - d00) * (1.F - fy)) + ((d11 - d01) * fy),
+                   ((d01 - d00) * (1.F - fx)) + ((d11 - d10) * fx));
+        return grad.normalized();
+    }
+}  // namespace simlab
@@ -0,0 +1,178 @@
+#include "simlab/core/SleepManager.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
+namespace simlab {
+
+    SleepManager::SleepManager(SleepSettings settings) : m_settings(settings) {}
+
+    void SleepManager::resize(std::size_t bodyCount) {
+        std::size_t oldCount = m_awake.size();
+
+        m_awake.resize(bodyCount, 1);
+        m_restTime.resize(bodyCount, 0.F);
+        m_parent.resize(bodyCount);
+        m_islandIds.resize(bodyCount);
+        m_islandRest.resize(bodyCount);
+
+        // New bodies start as their own island
+        for (std::size_t body = oldCount; body < bodyCount; body++) {
+            m_islandIds[body] = static_cast<std::uint32_t>(body);
+        }
+
+        // Shrinking can orphan island ids; give each body its own island
+        if (bodyCount < oldCount) {
+            wakeAll();
+        }
+        rebuildMembership();
+    }
+
+    void SleepManager::update(const std::vector<ContactPair>& contacts,
+                              std::vector<Vec2f>&             velocities,
+                              float                           dt) {
+        if (velocities.size() != m_awake.size()) {
+            resize(velocities.size());
+        }
+
+        const float thresholdSq =
+            m_settings.linearThreshold * m_settings.linearThreshold;
+        const std::size_t bodyCount = m_awake.size();
+
+        // External impulses wake the whole island
+        for (std::size_t body = 0; body < bodyCount; body++) {
+            if (m_awake[body] == 0 &&
+                velocities[body].lengthSquared() > thresholdSq) {
+                wakeIsland(m_islandIds[body]);
+            }
+        }
+
+        // Awake bodies touching sleeping islands wake them; repeat until no
+        // contact straddles an awake and a sleeping body
+        bool changed = true;
+        while (changed) {
+            changed = false;
+            for (const auto& contact : contacts) {
+                if (m_awake[contact.bodyA] == m_awake[contact.bodyB]) {
+                    continue;
+                }
+                std::uint32_t sleeper =
+                    m_awake[contact.bodyA] != 0 ? contact.bodyB : contact.bodyA;
+                wakeIsland(m_islandIds[sleeper]);
+                changed = true;
+            }
+        }
+
+        // Rest timers and island connectivity for awake bodies only
+        for (std::size_t body = 0; body < bodyCount; body++) {
+            if (m_awake[body] == 0) {
+                continue;
+            }
+            if (velocities[body].lengthSquared() < thresholdSq) {
+                m_restTime[body] += dt;
+            } else {
+                m_restTime[body] = 0.F;
+            }
+            m_parent[body] = static_cast<std::uint32_t>(body);
+        }
+
+        for (const auto& contact : contacts) {
+            if (m_awake[contact.bodyA] != 0 && m_awake[contact.bodyB] != 0) {
+                unite(contact.bodyA, contact.bodyB);
+            }
+        }
+
+        // An island rests only as long as its most recently moving body
+        for (std::size_t body = 0; body < bodyCount; body++) {
+            if (m_awake[body] != 0) {
+                m_islandRest[findRoot(static_cast<std::uint32_t>(body))] =
+                    std::numeric_limits<float>::max();
+            }
+        }
+        for (std::size_t body = 0; body < bodyCount; body++) {
+            if (m_awake[body] == 0) {
+                continue;
+            }
+            std::uint32_t root = findRoot(static_cast<std::uint32_t>(body));
+            m_islandIds[body]  = root;
+            m_islandRest[root] = std::min(m_islandRest[root], m_restTime[body]);
+        }
+
+        for (std::size_t body = 0; body < bodyCount; body++) {
+            if (m_awake[body] != 0 &&
+                m_islandRest[m_islandIds[body]] >= m_settings.timeToSleep) {
+                m_awake[body]    = 0;
+                velocities[body] = {0.F, 0.F};
+            }
+        }
+
+        rebuildMembership();
+    }
+
+    void SleepManager::wake(std::size_t body) {
+        wakeIsland(m_islandIds[body]);
+    }
+
+    void SleepManager::wakeAll() {
+        std::fill(m_awake.begin(), m_awake.end(), 1);
+        std::fill(m_restTime.begin(), m_restTime.end(), 0.F);
+        std::iota(m_islandIds.begin(), m_islandIds.end(), 0U);
+    }
+
+    auto SleepManager::getSleepingCount() const -> std::size_t {
+        return static_cast<std::size_t>(
+            std::count(m_awake.begin(), m_awake.end(), 0));
+    }
+
+    auto SleepManager::findRoot(std::uint32_t body) -> std::uint32_t {
+        while (m_parent[body] != body) {
+            m_parent[body] = m_parent[m_parent[body]];  // Path halving
+            body           = m_parent[body];
+        }
+        return body;
+    }
+
+    void SleepManager::unite(std::uint32_t bodyA, std::uint32_t bodyB) {
+        std::uint32_t rootA = findRoot(bodyA);
+        std::uint32_t rootB = findRoot(bodyB);
+        if (rootA != rootB) {
+            m_parent[std::max(rootA, rootB)] = std::min(rootA, rootB);
+        }
+    }
+
+    void SleepManager::wakeIsland(std::uint32_t island) {
+        for (std::uint32_t i = m_islandOffsets[island];
+             i < m_islandOffsets[island + 1]; i++) {
+            std::uint32_t body = m_islandBodies[i];
+            m_awake[body]      = 1;
+            m_restTime[body]   = 0.F;
+        }
+    }
+
+    void SleepManager::rebuildMembership() {
+        const std::size_t bodyCount = m_awake.size();
+
+        m_islandOffsets.assign(bodyCount + 1, 0);
+        for (std::size_t body = 0; body < bodyCount; body++) {
+            m_islandOffsets[m_islandIds[body] + 1]++;
+        }
+
+        m_islandCount = 0;
+        for (std::size_t island = 0; island < bodyCount; island++) {
+            if (m_islandOffsets[island + 1] != 0) {
+                m_islandCount++;
+            }
+            m_islandOffsets[island + 1] += m_islandOffsets[island];
+        }
+
+        // m_parent is free scratch here; use it as the insertion cursor
+        std::copy(m_islandOffsets.begin(), m_islandOffsets.end() - 1,
+                  m_parent.begin());
+        m_islandBodies.resize(bodyCount);
+        for (std::size_t body = 0; body < bodyCount; body++) {
+            m_islandBodies[m_parent[m_islandIds[body]]++] =
+                static_cast<std::uint32_t>(body);
+        }
+    }
+}  // namespace simlab
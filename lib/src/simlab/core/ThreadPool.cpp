@@ -0,0 +1,104 @@
+#include "simlab/core/ThreadPool.hpp"
+
+#include "simlab/core/Profiler.hpp"
+
+#include <algorithm>
+
+namespace simlab {
+
+    ThreadPool::ThreadPool(std::size_t workerCount) {
+        m_workers.reserve(workerCount);
+        for (std::size_t i = 0; i < workerCount; i++) {
+            m_workers.emplace_back(&ThreadPool::workerLoop, this);
+        }
+    }
+
+    ThreadPool::~ThreadPool() {
+        {
+            std::scoped_lock lock(m_mutex);
+            m_stopping = true;
+        }
+        m_startCondition.notify_all();
+
+        for (auto& worker : m_workers) {
+            if (worker.joinable()) {
+                worker.join();
+            }
+        }
+    }
+
+    void ThreadPool::parallelFor(std::size_t count, const RangeFunction& func,
+                                 std::size_t minChunk) {
+        if (count == 0) {
+            return;
+        }
+
+        minChunk = std::max<std::size_t>(minChunk, 1);
+        if (m_workers.empty() || count <= minChunk) {
+            func(0, count);
+            return;
+        }
+
+        // Aim for a few chunks per thread so uneven work still balances
+        std::size_t threads   = m_workers.size() + 1;
+        std::size_t chunkSize = std::max(minChunk, count / (threads * 4));
+
+        {
+            std::scoped_lock lock(m_mutex);
+            m_job         = &func;
+            m_jobCount    = count;
+            m_chunkSize   = chunkSize;
+            m_busyWorkers = m_workers.size();
+            m_nextIndex.store(0, std::memory_order_relaxed);
+            m_generation++;
+        }
+        m_startCondition.notify_all();
+
+        runChunks();
+
+        // Wait until every worker has left the job before releasing func
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_doneCondition.wait(lock,
+                             [this]() -> bool { return m_busyWorkers == 0; });
+        m_job = nullptr;
+    }
+
+    void ThreadPool::workerLoop() {
+        SIMLAB_PROFILE_THREAD("Pool Worker");
+        std::uint64_t seenGeneration = 0;
+
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_startCondition.wait(lock, [&]() -> bool {
+                    return m_stopping || m_generation != seenGeneration;
+                });
+                if (m_stopping) {
+                    return;
+                }
+                seenGeneration = m_generation;
+            }
+
+            SIMLAB_PROFILE_ZONE("ParallelFor");
+            runChunks();
+
+            {
+                std::scoped_lock lock(m_mutex);
+                m_busyWorkers--;
+            }
+            m_doneCondition.notify_one();
+        }
+    }
+
+    void ThreadPool::runChunks() {
+        while (true) {
+            std::size_t begin =
+                m_nextIndex.fetch_add(m_chunkSize, std::memory_order_relaxed);
+            if (begin >= m_jobCount) {
+                return;
+            }
+            std::size_t end = std::min(begin + m_chunkSize, m_jobCount);
+            (*m_job)(begin, end);
+        }
+    }
+}  // namespace simlab
@@ -1,10 +1,57 @@
 #include "simlab/drawables/BezierCurve.hpp"
 
-#include <random>
+#include "simlab/core/Random.hpp"
+
+#include <algorithm>
+#include <array>
 
 namespace Drawables {
     using sf::Lines;
 
+    namespace {
+
+        // Construction-line snapshots drawn along the curve
+        constexpr int LineSnapshots = 25;
+
+        auto sampleCount(double step) -> std::size_t {
+            return static_cast<std::size_t>(1.0 / step) + 1;
+        }
+
+        // Clamped: 1 / step need not be a whole number
+        auto sampleAt(std::size_t k, double step) -> double {
+            return std::min(static_cast<double>(k) * step, 1.0);
+        }
+
+        // Halvings before a span is emitted regardless: 65536 segments
+        constexpr int MaxSubdivisionDepth = 16;
+
+        /**
+         * @brief Whether every inner control point lies within tolerance
+         * of the chord segment. The curve stays inside its control
+         * polygon's hull, so the chord is then within tolerance of it
+         */
+        auto isFlat(const sf::Vector2f* polygon, std::size_t count,
+                    float toleranceSq) -> bool {
+            const sf::Vector2f start    = polygon[0];
+            const sf::Vector2f chord    = polygon[count - 1] - start;
+            const float        lengthSq = utils::magnitudeSquared(chord);
+            for (std::size_t i = 1; i + 1 < count; i++) {
+                sf::Vector2f offset = polygon[i] - start;
+                float        along  = 0.F;
+                if (lengthSq > 0.F) {
+                    along = std::clamp(
+                        utils::dotProduct(offset, chord) / lengthSq, 0.F,
+                        1.F);
+                }
+                if (utils::magnitudeSquared(offset - (along * chord)) >
+                    toleranceSq) {
+                    return false;
+                }
+            }
+            return true;
+        }
+    }  // namespace
+
     BezierCurve::BezierCurve(std::vector<sf::Vector2f> controlPoints,
                              double                    step)
         : curve(sf::LinesStrip),
@@ -82,6 +129,14 @@ namespace Drawables {
         updateCurve();
     }
 
+    auto BezierCurve::setTolerance(float tolerance) -> void {
+        if (tolerance <= 0.F) {
+            throw std::logic_error("Bezier tolerance must be positive");
+        }
+        this->tolerance = tolerance;
+        updateCurve();
+    }
+
     void BezierCurve::setPrimitiveType(sf::PrimitiveType type) {
         curve.setPrimitiveType(type);
     }
@@ -155,22 +210,154 @@ namespace Drawables {
     }
 
     auto BezierCurve::updateCurve() -> void {
-        curve.clear();
         dotlines.clear();
-        lines.clear();
-        int delta = static_cast<int>(1.0 / step);
-        for (int k = 0; k <= delta; ++k) {
-            double i    = static_cast<double>(k) * step;
-            i           = std::min(i, 1.0);  // clamp to avoid o
-            auto vertex = getCurvePoints(controlPoints, i, lines)[0];
-            curve.append(sf::Vertex(vertex, curveColor));
-        }
         for (const auto& point : controlPoints) {
             dotlines.append(sf::Vertex(point, controlPointColor));
         }
-        // fmt::print("Control Points: {}\n", controlPoints.size());
-        // fmt::print("curve Points: {}\n", curve.getVertexCount());
-        // fmt::print("Lines Points: {}\n", lines.getVertexCount());
+
+        const std::size_t count = controlPoints.size();
+        if (count == 0) {
+            curve.clear();
+            lines.clear();
+            return;
+        }
+        if (adaptive_) {
+            updateAdaptive();
+        } else {
+            updateUniform();
+        }
+        if (showLines_) {
+            updateLines();
+        }
+    }
+
+    auto BezierCurve::updateUniform() -> void {
+        const std::size_t count = controlPoints.size();
+        if (weightsPointCount != count || weightsStep != step) {
+            updateWeights();
+        }
+
+        const std::size_t samples = weights.size() / count;
+        const float*      weight  = weights.data();
+        curve.resize(samples);
+        for (std::size_t k = 0; k < samples; k++, weight += count) {
+            sf::Vector2f point;
+            for (std::size_t i = 0; i < count; i++) {
+                point += weight[i] * controlPoints[i];
+            }
+            curve[k] = sf::Vertex(point, curveColor);
+        }
+    }
+
+    auto BezierCurve::updateWeights() -> void {
+        const std::size_t count   = controlPoints.size();
+        const std::size_t degree  = count - 1;
+        const std::size_t samples = sampleCount(step);
+
+        // C(n, i), then C(n, i) t^i (1 - t)^(n - i) per sample
+        std::vector<double> binomial(count, 1.0);
+        for (std::size_t i = 1; i < degree; i++) {
+            binomial[i] = binomial[i - 1] *
+                          static_cast<double>(degree - i + 1) /
+                          static_cast<double>(i);
+        }
+
+        std::vector<double> sPow(count, 1.0);
+        weights.resize(samples * count);
+        for (std::size_t k = 0; k < samples; k++) {
+            double t = sampleAt(k, step);
+            for (std::size_t i = 1; i < count; i++) {
+                sPow[i] = sPow[i - 1] * (1.0 - t);
+            }
+            double tPow = 1.0;
+            for (std::size_t i = 0; i < count; i++) {
+                weights[(k * count) + i] =
+                    static_cast<float>(binomial[i] * tPow * sPow[degree - i]);
+                tPow *= t;
+            }
+        }
+        weightsPointCount = count;
+        weightsStep       = step;
+    }
+
+    auto BezierCurve::updateAdaptive() -> void {
+        const std::size_t count = controlPoints.size();
+        curve.clear();
+        curve.append(sf::Vertex(controlPoints[0], curveColor));
+        if (count == 1) {
+            return;
+        }
+
+        // Depth-first over a stack of control polygons, one slot per
+        // depth, with the split scratch polygon in the last slot
+        subdivision.resize((MaxSubdivisionDepth + 2) * count);
+        sf::Vector2f* scratch =
+            subdivision.data() + ((MaxSubdivisionDepth + 1) * count);
+        std::array<int, MaxSubdivisionDepth + 1> depth{};
+        const float toleranceSq = tolerance * tolerance;
+
+        std::copy(controlPoints.begin(), controlPoints.end(),
+                  subdivision.begin());
+        int top = 0;
+        while (top >= 0) {
+            sf::Vector2f* polygon = subdivision.data() + (top * count);
+            if (depth[top] == MaxSubdivisionDepth ||
+                isFlat(polygon, count, toleranceSq)) {
+                curve.append(sf::Vertex(polygon[count - 1], curveColor));
+                top--;
+                continue;
+            }
+
+            // Split at t = 1/2: the right half replaces this polygon and
+            // the left half goes above it, so it is emitted first
+            sf::Vector2f* left = polygon + count;
+            std::copy(polygon, polygon + count, scratch);
+            left[0] = scratch[0];
+            for (std::size_t level = 1; level < count; level++) {
+                for (std::size_t i = 0; i < count - level; i++) {
+                    scratch[i] = 0.5F * (scratch[i] + scratch[i + 1]);
+                }
+                left[level]                = scratch[0];
+                polygon[count - 1 - level] = scratch[count - 1 - level];
+            }
+            depth[top + 1] = ++depth[top];
+            top++;
+        }
+    }
+
+    auto BezierCurve::updateLines() -> void {
+        lines.clear();
+        const std::size_t count = controlPoints.size();
+        if (count < 2) {
+            return;
+        }
+
+        // Fixed seed, so colors hold still while a point is dragged
+        simlab::Random random(100);
+
+        // de Casteljau at the first sample of each snapshot interval,
+        // keeping every intermediate point
+        int lastSnapshot = -1;
+        for (std::size_t k = 0; k < sampleCount(step); k++) {
+            auto t        = static_cast<float>(sampleAt(k, step));
+            int  snapshot = static_cast<int>(t * LineSnapshots);
+            if (snapshot == lastSnapshot) {
+                continue;
+            }
+            lastSnapshot = snapshot;
+
+            construction.assign(controlPoints.begin(), controlPoints.end());
+            for (std::size_t level = count - 1; level > 0; level--) {
+                for (std::size_t i = 0; i < level; i++) {
+                    construction[i] = ((1.F - t) * construction[i]) +
+                                      (t * construction[i + 1]);
+                    sf::Color color(random.uniformInt(0, 255),
+                                    random.uniformInt(0, 255),
+                                    random.uniformInt(0, 255));
+                    lines.append(sf::Vertex(construction[i], color));
+                }
+            }
+        }
     }
 
     auto BezierCurve::enableDotLines(bool enabled) -> void {
@@ -179,6 +366,18 @@ namespace Drawables {
 
     auto BezierCurve::enableLines(bool enabled) -> void {
         showLines_ = enabled;
+        if (enabled) {
+            updateLines();
+        }
+    }
+
+    auto BezierCurve::enableAdaptive(bool enabled) -> void {
+        adaptive_ = enabled;
+        updateCurve();
+    }
+
+    auto BezierCurve::getCurveVertexCount() const -> std::size_t {
+        return curve.getVertexCount();
     }
 
     auto BezierCurve::enableControlPoints(bool enabled) -> void {
@@ -193,40 +392,27 @@ namespace Drawables {
         return controlPoints;
     }
 
-    auto BezierCurve::getCurvePoints(std::vector<sf::Vector2f>& pointArray,
-                                     float t, sf::VertexArray& lines)
-        -> std::vector<sf::Vector2f> {
-        static std::uniform_int_distribution<int> distColor(0, 255);
-        static std::mt19937                       generator(100);
-        static int                                delta = -1;
-        int  step    = static_cast<int>(t * 25);
-        bool changed = false;
-        if (delta != step) {
-            delta   = step;
-            changed = true;
-            fmt::print("delta: {}\n", delta);
+    auto BezierCurve::evaluate(float t) const -> sf::Vector2f {
+        if (controlPoints.empty()) {
+            return {};
         }
-        if (pointArray.size() == 1) {
-            return pointArray;
+        const std::size_t degree = controlPoints.size() - 1;
+        if (degree == 0) {
+            return controlPoints[0];
         }
 
-        auto result = std::vector<sf::Vector2f>();
-
-        for (size_t i = 0; i < pointArray.size() - 1; i++) {
-            auto pointA = pointArray[i];
-            auto pointB = pointArray[i + 1];
-
-            auto lerp = utils::lerp(pointA, pointB, t);
-            if (changed) {
-                sf::Color color(distColor(generator), distColor(generator),
-                                distColor(generator));
-                lines.append(sf::Vertex(lerp, color));
-            }
-
-            result.emplace_back(lerp);
+        // Sum of C(n, i) t^i s^(n - i) P_i, nested in s like Horner
+        const float  s        = 1.F - t;
+        float        tPow     = 1.F;
+        float        binomial = 1.F;
+        sf::Vector2f point    = controlPoints[0] * s;
+        for (std::size_t i = 1; i < degree; i++) {
+            tPow *= t;
+            binomial = binomial * static_cast<float>(degree - i + 1) /
+                       static_cast<float>(i);
+            point    = (point + ((tPow * binomial) * controlPoints[i])) * s;
         }
-
-        return getCurvePoints(result, t, lines);
+        return point + ((tPow * t) * controlPoints[degree]);
     }
 
     void BezierCurve::handleEvents(const sf::Event&  event,
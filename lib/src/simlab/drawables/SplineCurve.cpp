@@ -0,0 +1,286 @@
+#include "simlab/drawables/SplineCurve.hpp"
+
+#include "simlab/core/Geometry.hpp"
+#include "simlab/core/utils.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace Drawables {
+
+    namespace {
+
+        using Basis = std::array<std::array<float, 4>, 4>;
+
+        // Rows are the coefficients of 1, t, t^2, t^3; columns the four
+        // segment points
+        constexpr Basis CatmullRomBasis = {{{0.F, 1.F, 0.F, 0.F},
+                                            {-0.5F, 0.F, 0.5F, 0.F},
+                                            {1.F, -2.5F, 2.F, -0.5F},
+                                            {-0.5F, 1.5F, -1.5F, 0.5F}}};
+
+        constexpr Basis BSplineBasis = {
+            {{1.F / 6.F, 4.F / 6.F, 1.F / 6.F, 0.F},
+             {-0.5F, 0.F, 0.5F, 0.F},
+             {0.5F, -1.F, 0.5F, 0.F},
+             {-1.F / 6.F, 0.5F, -0.5F, 1.F / 6.F}}};
+
+        constexpr Basis BezierBasis = {{{1.F, 0.F, 0.F, 0.F},
+                                        {-3.F, 3.F, 0.F, 0.F},
+                                        {3.F, -6.F, 3.F, 0.F},
+                                        {-1.F, 3.F, -3.F, 1.F}}};
+
+        constexpr float HitRadius = 20.F;
+
+        auto basisFor(SplineCurve::Type type) -> const Basis& {
+            switch (type) {
+                case SplineCurve::Type::BSpline:
+                    return BSplineBasis;
+                case SplineCurve::Type::Bezier:
+                    return BezierBasis;
+                case SplineCurve::Type::CatmullRom:
+                default:
+                    return CatmullRomBasis;
+            }
+        }
+    }  // namespace
+
+    SplineCurve::SplineCurve(std::vector<sf::Vector2f> controlPoints,
+                             Type type, std::size_t segmentSamples)
+        : curve(sf::LineStrip),
+          polygon(sf::LineStrip),
+          handles(sf::Triangles),
+          type(type),
+          segmentSamples(segmentSamples) {
+        if (segmentSamples == 0) {
+            throw std::logic_error("SplineCurve needs 1+ samples a segment");
+        }
+        updateWeights();
+        setControlPoints(std::move(controlPoints));
+    }
+
+    void SplineCurve::setControlPoint(std::size_t index, sf::Vector2f point) {
+        if (index >= controlPoints.size()) {
+            throw std::logic_error("index out of range for the Control Point");
+        }
+        controlPoints[index]    = point;
+        polygon[index].position = point;
+        writeHandle(index);
+
+        auto [first, last] = affectedSegments(index);
+        tessellate(first, last);
+    }
+
+    void SplineCurve::setControlPoints(std::vector<sf::Vector2f> points) {
+        controlPoints = std::move(points);
+        rebuild();
+    }
+
+    void SplineCurve::append(sf::Vector2f point) {
+        controlPoints.push_back(point);
+        polygon.append(sf::Vertex(point, controlPointColor));
+        handles.resize(handles.getVertexCount() +
+                       simlab::Geometry::RectangleVertexCount);
+        writeHandle(controlPoints.size() - 1);
+
+        // Earlier segments keep their vertices; only new ones are written
+        std::size_t segments = getSegmentCount();
+        if (segments > 0) {
+            curve.resize((segments * segmentSamples) + 1);
+        }
+        auto [first, last] = affectedSegments(controlPoints.size() - 1);
+        tessellate(first, last);
+    }
+
+    void SplineCurve::clear() {
+        controlPoints.clear();
+        rebuild();
+    }
+
+    void SplineCurve::setType(Type type) {
+        this->type = type;
+        updateWeights();
+        rebuild();
+    }
+
+    void SplineCurve::setSegmentSamples(std::size_t samples) {
+        if (samples == 0) {
+            throw std::logic_error("SplineCurve needs 1+ samples a segment");
+        }
+        segmentSamples = samples;
+        updateWeights();
+        rebuild();
+    }
+
+    void SplineCurve::setCurveColor(sf::Color color) {
+        curveColor = color;
+        for (std::size_t i = 0; i < curve.getVertexCount(); i++) {
+            curve[i].color = color;
+        }
+    }
+
+    void SplineCurve::setControlPointColor(sf::Color color) {
+        controlPointColor = color;
+        for (std::size_t i = 0; i < polygon.getVertexCount(); i++) {
+            polygon[i].color = color;
+        }
+        for (std::size_t i = 0; i < handles.getVertexCount(); i++) {
+            handles[i].color = color;
+        }
+    }
+
+    void SplineCurve::setControlPointRadius(float radius) {
+        controlPointRadius = radius;
+        for (std::size_t i = 0; i < controlPoints.size(); i++) {
+            writeHandle(i);
+        }
+    }
+
+    void SplineCurve::enableControlPoints(bool enabled) {
+        showControlPoints_ = enabled;
+    }
+
+    void SplineCurve::enableControlPolygon(bool enabled) {
+        showControlPolygon_ = enabled;
+    }
+
+    auto SplineCurve::operator[](std::size_t index) const
+        -> const sf::Vector2f& {
+        return controlPoints[index];
+    }
+
+    auto SplineCurve::getControlPointCount() const -> std::size_t {
+        return controlPoints.size();
+    }
+
+    auto SplineCurve::getSegmentCount() const -> std::size_t {
+        if (controlPoints.size() < 4) {
+            return 0;
+        }
+        if (type == Type::Bezier) {
+            return (controlPoints.size() - 1) / 3;
+        }
+        return controlPoints.size() - 3;
+    }
+
+    auto SplineCurve::getCurveVertexCount() const -> std::size_t {
+        return curve.getVertexCount();
+    }
+
+    auto SplineCurve::stride() const -> std::size_t {
+        return type == Type::Bezier ? 3 : 1;
+    }
+
+    auto SplineCurve::affectedSegments(std::size_t index) const
+        -> std::pair<std::size_t, std::size_t> {
+        // Segment s reads points s * stride .. s * stride + 3
+        std::size_t step     = stride();
+        std::size_t segments = getSegmentCount();
+        std::size_t first    = index < 3 ? 0 : (index - 3 + step - 1) / step;
+        std::size_t last     = std::min((index / step) + 1, segments);
+        return {std::min(first, last), last};
+    }
+
+    void SplineCurve::updateWeights() {
+        const Basis& basis = basisFor(type);
+        weights.resize(segmentSamples + 1);
+        for (std::size_t j = 0; j <= segmentSamples; j++) {
+            float t = static_cast<float>(j) /
+                      static_cast<float>(segmentSamples);
+            std::array<float, 4> powers = {1.F, t, t * t, t * t * t};
+            for (std::size_t k = 0; k < 4; k++) {
+                weights[j][k] = (powers[0] * basis[0][k]) +
+                                (powers[1] * basis[1][k]) +
+                                (powers[2] * basis[2][k]) +
+                                (powers[3] * basis[3][k]);
+            }
+        }
+    }
+
+    void SplineCurve::rebuild() {
+        draggingIndex = -1;
+
+        polygon.resize(controlPoints.size());
+        handles.resize(controlPoints.size() *
+                       simlab::Geometry::RectangleVertexCount);
+        for (std::size_t i = 0; i < controlPoints.size(); i++) {
+            polygon[i] = sf::Vertex(controlPoints[i], controlPointColor);
+            writeHandle(i);
+        }
+
+        std::size_t segments = getSegmentCount();
+        curve.resize(segments > 0 ? (segments * segmentSamples) + 1 : 0);
+        tessellate(0, segments);
+    }
+
+    void SplineCurve::tessellate(std::size_t first, std::size_t last) {
+        const std::size_t step     = stride();
+        const std::size_t segments = getSegmentCount();
+        for (std::size_t s = first; s < last; s++) {
+            const sf::Vector2f* p = &controlPoints[s * step];
+            // The last segment also writes the curve's closing vertex
+            std::size_t samples =
+                s + 1 == segments ? segmentSamples + 1 : segmentSamples;
+            for (std::size_t j = 0; j < samples; j++) {
+                const auto& w = weights[j];
+                curve[(s * segmentSamples) + j] = sf::Vertex(
+                    (w[0] * p[0]) + (w[1] * p[1]) + (w[2] * p[2]) +
+                        (w[3] * p[3]),
+                    curveColor);
+            }
+        }
+    }
+
+    void SplineCurve::writeHandle(std::size_t index) {
+        simlab::Geometry::writeRectangle(
+            &handles[index * simlab::Geometry::RectangleVertexCount],
+            controlPoints[index],
+            {2.F * controlPointRadius, 2.F * controlPointRadius},
+            controlPointColor);
+    }
+
+    void SplineCurve::handleEvents(const sf::Event&  event,
+                                   sf::RenderWindow& window) {
+        if (!showControlPoints_) {
+            return;
+        }
+
+        sf::Vector2i mousePixel = sf::Mouse::getPosition(window);
+        sf::Vector2f mouseWorld = window.mapPixelToCoords(mousePixel);
+
+        if (event.type == sf::Event::MouseButtonPressed &&
+            event.mouseButton.button == sf::Mouse::Left) {
+            // Nearest point under the cursor, so dense paths stay usable
+            float best = HitRadius * HitRadius;
+            for (std::size_t i = 0; i < controlPoints.size(); i++) {
+                float d = utils::distanceSquared(controlPoints[i], mouseWorld);
+                if (d < best) {
+                    best          = d;
+                    draggingIndex = static_cast<int>(i);
+                }
+            }
+        }
+
+        if (event.type == sf::Event::MouseButtonReleased &&
+            event.mouseButton.button == sf::Mouse::Left) {
+            draggingIndex = -1;
+        }
+
+        if (draggingIndex != -1 && event.type == sf::Event::MouseMoved) {
+            setControlPoint(static_cast<std::size_t>(draggingIndex),
+                            mouseWorld);
+        }
+    }
+
+    void SplineCurve::draw(sf::RenderTarget& target,
+                           sf::RenderStates  states) const {
+        target.draw(curve, states);
+
+        if (showControlPolygon_) {
+            target.draw(polygon, states);
+        }
+        if (showControlPoints_) {
+            target.draw(handles, states);
+        }
+    }
+}  // namespace Drawables
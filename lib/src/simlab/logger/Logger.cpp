@@ -0,0 +1,388 @@
+#include "simlab/logger/Logger.hpp"
+
+#include <cstdio>
+#include <deque>
+#include <iterator>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+namespace Logger {
+
+    namespace {
+
+        constexpr std::size_t RingMask = Logger::RingCapacity - 1;
+
+        // Idle writer re-checks the ring this often
+        constexpr std::chrono::milliseconds PollInterval(5);
+
+        static_assert((Logger::RingCapacity & RingMask) == 0,
+                      "RingCapacity must be a power of two");
+        static_assert(sizeof(Logger::Record) == Logger::RecordSize,
+                      "Record layout must fill RecordSize exactly");
+
+        struct SiteInfo {
+            std::string      format;
+            std::string      file;
+            int              line;
+            Binary::DecodeFn decode;
+            std::string      signature;
+        };
+
+        // Binary call sites by id - 1; only ever appended to
+        struct SiteRegistry {
+            std::mutex           mutex;
+            std::deque<SiteInfo> sites;
+        };
+
+        auto siteRegistry() -> SiteRegistry& {
+            static SiteRegistry registry;
+            return registry;
+        }
+
+        template <typename T>
+        void appendRaw(fmt::memory_buffer& buffer, T value) {
+            const auto* bytes = reinterpret_cast<const char*>(&value);
+            buffer.append(bytes, bytes + sizeof(T));
+        }
+
+        void appendString(fmt::memory_buffer& buffer, std::string_view text) {
+            appendRaw(buffer, static_cast<std::uint16_t>(text.size()));
+            buffer.append(text.data(), text.data() + text.size());
+        }
+    }  // namespace
+
+    Logger::Logger() : ring_(std::make_unique<Record[]>(RingCapacity)) {
+        startWriter();
+    }
+
+    Logger::Logger(std::ofstream logFile)
+        : ring_(std::make_unique<Record[]>(RingCapacity)),
+          logFile_(std::move(logFile)) {
+        startWriter();
+    }
+
+    Logger::~Logger() {
+        stopWriter();
+        if (logFile_.is_open()) {
+            logFile_.close();
+        }
+        if (binaryFile_.is_open()) {
+            binaryFile_.close();
+        }
+    }
+
+    void Logger::setLogFile(const std::string& filename) {
+        std::scoped_lock lock(fileMutex_);
+        if (logFile_.is_open()) {
+            logFile_.close();
+        }
+        logFile_.open(filename, std::ios::app);
+    }
+
+    void Logger::setBinaryLogFile(const std::string& filename) {
+        std::scoped_lock lock(fileMutex_);
+        if (binaryFile_.is_open()) {
+            binaryFile_.close();
+        }
+        binaryFile_.open(filename, std::ios::binary | std::ios::trunc);
+        if (!binaryFile_.is_open()) {
+            throw std::runtime_error("Failed to open binary log: " + filename);
+        }
+        binaryFile_.write(
+            Binary::FileMagic.data(),
+            static_cast<std::streamsize>(Binary::FileMagic.size()));
+        binaryGeneration_++;  // Sites must be written again
+    }
+
+    auto Logger::registerSite(FormatSite& site, Binary::DecodeFn decode,
+                              std::string signature) -> std::uint32_t {
+        SiteRegistry&    registry = siteRegistry();
+        std::scoped_lock lock(registry.mutex);
+
+        // Another thread may have won the race for this site
+        std::uint32_t id = site.id.load(std::memory_order_acquire);
+        if (id != 0) {
+            return id;
+        }
+        registry.sites.push_back(
+            {site.format, site.file, site.line, decode, std::move(signature)});
+        id = static_cast<std::uint32_t>(registry.sites.size());
+        site.id.store(id, std::memory_order_release);
+        return id;
+    }
+
+    void Logger::setFlushPolicy(FlushPolicy               policy,
+                                std::chrono::milliseconds interval) {
+        std::scoped_lock lock(writerMutex_);
+        flushPolicy_   = policy;
+        flushInterval_ = interval;
+    }
+
+    void Logger::flush() {
+        std::unique_lock lock(writerMutex_);
+        if (stopping_) {
+            return;
+        }
+        std::size_t target = enqueuePos_.load(std::memory_order_acquire);
+        flushTarget_       = std::max(flushTarget_, target);
+        writerWake_.notify_one();
+        flushDone_.wait(lock, [this, target]() -> bool {
+            return flushedUpTo_ >= target || stopping_;
+        });
+    }
+
+    auto Logger::claim(std::size_t& position) -> Record* {
+        std::size_t pos = enqueuePos_.load(std::memory_order_relaxed);
+        while (true) {
+            Record&     record   = ring_[pos & RingMask];
+            std::size_t sequence =
+                record.sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<std::intptr_t>(sequence) -
+                        static_cast<std::intptr_t>(pos);
+
+            if (diff == 0) {
+                if (enqueuePos_.compare_exchange_weak(
+                        pos, pos + 1, std::memory_order_relaxed)) {
+                    position = pos;
+                    return &record;
+                }
+            } else if (diff < 0) {
+                // Full: the writer has not released this slot yet
+                if (overflowPolicy_.load(std::memory_order_relaxed) ==
+                    OverflowPolicy::Drop) {
+                    dropped_.fetch_add(1, std::memory_order_relaxed);
+                    return nullptr;
+                }
+                std::this_thread::yield();
+                pos = enqueuePos_.load(std::memory_order_relaxed);
+            } else {
+                pos = enqueuePos_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    void Logger::publish(Record* record, std::size_t position, bool urgent) {
+        record->sequence.store(position + 1, std::memory_order_release);
+        if (urgent) {
+            {
+                std::scoped_lock lock(writerMutex_);
+                urgent_ = true;
+            }
+            writerWake_.notify_one();
+        }
+    }
+
+    void Logger::startWriter() {
+        for (std::size_t i = 0; i < RingCapacity; i++) {
+            ring_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+        writer_ = std::thread(&Logger::writerLoop, this);
+    }
+
+    void Logger::stopWriter() {
+        {
+            std::scoped_lock lock(writerMutex_);
+            stopping_ = true;
+        }
+        writerWake_.notify_one();
+        flushDone_.notify_all();
+        if (writer_.joinable()) {
+            writer_.join();
+        }
+    }
+
+    void Logger::writerLoop() {
+        fmt::memory_buffer console;
+        fmt::memory_buffer file;
+        fmt::memory_buffer binary;
+        fmt::memory_buffer decoded;
+        auto               lastFlush = std::chrono::steady_clock::now();
+        bool               dirty     = false;
+
+        // Writer-side copy of the site registry, grown on demand
+        std::vector<SiteInfo> sites;
+        std::vector<bool>     sitesWritten;
+        std::uint64_t         generation = 0;
+
+        auto findSite = [&](std::uint32_t id) -> const SiteInfo* {
+            if (id > sites.size()) {
+                SiteRegistry&    registry = siteRegistry();
+                std::scoped_lock lock(registry.mutex);
+                sites.insert(sites.end(),
+                             registry.sites.begin() +
+                                 static_cast<std::ptrdiff_t>(sites.size()),
+                             registry.sites.end());
+                sitesWritten.resize(sites.size(), false);
+            }
+            return id <= sites.size() ? &sites[id - 1] : nullptr;
+        };
+
+        auto write = [&]() {
+            if (console.size() != 0) {
+                std::fwrite(console.data(), 1, console.size(), stdout);
+                console.clear();
+            }
+            std::scoped_lock lock(fileMutex_);
+            if (file.size() != 0) {
+                if (logFile_.is_open()) {
+                    logFile_.write(file.data(),
+                                   static_cast<std::streamsize>(file.size()));
+                }
+                file.clear();
+            }
+            if (binary.size() != 0) {
+                if (binaryFile_.is_open()) {
+                    binaryFile_.write(
+                        binary.data(),
+                        static_cast<std::streamsize>(binary.size()));
+                }
+                binary.clear();
+            }
+        };
+        auto flushOutput = [&]() {
+            std::fflush(stdout);
+            std::scoped_lock lock(fileMutex_);
+            if (logFile_.is_open()) {
+                logFile_.flush();
+            }
+            if (binaryFile_.is_open()) {
+                binaryFile_.flush();
+            }
+            lastFlush = std::chrono::steady_clock::now();
+            dirty     = false;
+        };
+
+        while (true) {
+            FlushPolicy               policy;
+            std::chrono::milliseconds interval;
+            {
+                std::scoped_lock lock(writerMutex_);
+                policy   = flushPolicy_;
+                interval = flushInterval_;
+            }
+            bool binaryOpen = false;
+            {
+                std::scoped_lock lock(fileMutex_);
+                binaryOpen = binaryFile_.is_open();
+                if (generation != binaryGeneration_) {
+                    generation = binaryGeneration_;
+                    sitesWritten.assign(sitesWritten.size(), false);
+                }
+            }
+
+            // Drain whatever is published, one batch per pass
+            std::size_t batch  = 0;
+            bool        urgent = false;
+            while (batch < RingCapacity) {
+                Record& record = ring_[dequeuePos_ & RingMask];
+                if (record.sequence.load(std::memory_order_acquire) !=
+                    dequeuePos_ + 1) {
+                    break;
+                }
+
+                std::string_view payload(record.text.data(), record.length);
+                std::string_view message = payload;
+                if (record.formatId != 0) {
+                    decoded.clear();
+                    const SiteInfo* site = findSite(record.formatId);
+                    try {
+                        if (site == nullptr) {
+                            throw fmt::format_error("unknown format site");
+                        }
+                        site->decode(site->format, payload.data(),
+                                     payload.size(), decoded);
+                    } catch (const fmt::format_error& e) {
+                        fmt::format_to(std::back_inserter(decoded),
+                                       "<binary record {}: {}>",
+                                       record.formatId, e.what());
+                    }
+                    message = {decoded.data(), decoded.size()};
+
+                    if (binaryOpen && site != nullptr &&
+                        !sitesWritten[record.formatId - 1]) {
+                        sitesWritten[record.formatId - 1] = true;
+                        appendRaw(binary, Binary::EntryTag::Site);
+                        appendRaw(binary, record.formatId);
+                        appendRaw(binary,
+                                  static_cast<std::uint32_t>(site->line));
+                        appendString(binary, site->format);
+                        appendString(binary, site->file);
+                        appendString(binary, site->signature);
+                    }
+                }
+                if (binaryOpen) {
+                    appendRaw(binary, Binary::EntryTag::Record);
+                    appendRaw(binary, record.formatId);
+                    appendRaw(binary, record.level);
+                    appendRaw(binary, record.timestamp);
+                    appendString(binary, payload);
+                }
+
+                auto seconds = static_cast<std::time_t>(
+                    record.timestamp / 1'000'000'000);
+                fmt::format_to(std::back_inserter(console),
+                               fg(getLevelColor(record.level)),
+                               "[{}] [{}] {}\n",
+                               getLevelString(record.level), seconds,
+                               message);
+                fmt::format_to(std::back_inserter(file), "[{}] [{}] {}\n",
+                               getLevelString(record.level), seconds,
+                               message);
+                urgent = urgent || record.level >= LogLevel::ERROR;
+
+                // Hand the slot back to producers one lap ahead
+                record.sequence.store(dequeuePos_ + RingCapacity,
+                                      std::memory_order_release);
+                dequeuePos_++;
+                batch++;
+
+                if (policy == FlushPolicy::EveryRecord) {
+                    write();
+                    flushOutput();
+                }
+            }
+
+            if (batch != 0) {
+                write();
+                dirty = true;
+            }
+
+            bool        stopping = false;
+            std::size_t target   = 0;
+            {
+                std::scoped_lock lock(writerMutex_);
+                stopping = stopping_;
+                target   = flushTarget_;
+            }
+            bool requested = target > flushedUpTo_ && dequeuePos_ >= target;
+
+            auto now = std::chrono::steady_clock::now();
+            if (dirty && (urgent || requested || stopping ||
+                          policy == FlushPolicy::EveryBatch ||
+                          now - lastFlush >= interval)) {
+                flushOutput();
+            }
+            if (requested) {
+                {
+                    std::scoped_lock lock(writerMutex_);
+                    flushedUpTo_ = dequeuePos_;
+                }
+                flushDone_.notify_all();
+            }
+
+            if (batch == 0) {
+                std::unique_lock lock(writerMutex_);
+                if (stopping_) {
+                    break;
+                }
+                writerWake_.wait_for(lock, PollInterval, [this]() -> bool {
+                    return stopping_ || urgent_ || flushTarget_ > flushedUpTo_;
+                });
+                urgent_ = false;
+            }
+        }
+        write();
+        flushOutput();
+    }
+}  // namespace Logger
@@ -0,0 +1,69 @@
+#include "simlab/simlab.hpp"
+
+#include <cmath>
+#include <vector>
+
+namespace {
+
+    // A long editable path; dragging any point only touches its segments
+    class DrawSplineCurve : public simlab::Game {
+      private:
+
+        static constexpr std::size_t PointCount = 2000;
+
+        Drawables::SplineCurve spline;
+
+        static auto wave(sf::Vector2u size) -> std::vector<sf::Vector2f> {
+            std::vector<sf::Vector2f> points(PointCount);
+            float dx = static_cast<float>(size.x) / (PointCount - 1);
+            for (std::size_t i = 0; i < PointCount; i++) {
+                auto x    = static_cast<float>(i) * dx;
+                points[i] = {x, (size.y / 2.F) +
+                                    (size.y / 4.F) * std::sin(x / 80.F)};
+            }
+            return points;
+        }
+
+      public:
+
+        DrawSplineCurve()
+            : simlab::Game("Spline Curve", sf::Style::Fullscreen),
+              spline(wave(window.getSize())) {
+            setFramerateLimit(120);
+            spline.setControlPointRadius(3.F);
+            spline.enableControlPolygon(true);
+            spline.setControlPointColor(sf::Color(255, 255, 255, 120));
+        }
+
+      private:
+
+        void Update(float /*dt*/) override {}
+
+        void Draw(sf::RenderWindow& win) override {
+            win.draw(spline);
+        }
+
+        // Right click cycles Catmull-Rom, B-spline and composite Bezier
+        void handleEvents(sf::Event& event) override {
+            static int type = 0;
+            spline.handleEvents(event, window);
+
+            if (event.type == sf::Event::MouseButtonPressed &&
+                event.mouseButton.button == sf::Mouse::Right) {
+                type = (type + 1) % 3;
+                spline.setType(
+                    static_cast<Drawables::SplineCurve::Type>(type));
+                log.info("Spline segments: {}, vertices: {}",
+                         spline.getSegmentCount(),
+                         spline.getCurveVertexCount());
+            }
+        }
+    };
+
+}  // namespace
+
+auto main(int /*argc*/, char* /*argv*/[]) -> int {
+    DrawSplineCurve game;
+    game.Run();
+    return 0;
+}
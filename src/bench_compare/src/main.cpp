@@ -0,0 +1,373 @@
+// Compare two Benchmark exports (see Benchmark::exportResults) and flag
+// statistically significant regressions of the current run against a
+// stored baseline. Files ending in .json are read as exportJson output,
+// anything else as exportCsv output, so the two formats can be mixed.
+//
+//   bench_compare <baseline> <current> [--threshold 0.05] [--alpha 0.01]
+//
+// A benchmark regresses when its mean grew by more than threshold and a
+// one-sided Welch t-test rejects "not slower" at level alpha. Exit code is
+// 1 when any benchmark regressed, 2 on bad input.
+
+#include "simlab/core/BenchmarkUtils.hpp"
+
+#include <fmt/color.h>
+#include <fmt/core.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+    struct Entry {
+        std::string name;
+        double      runs   = 0.0;
+        double      mean   = 0.0;
+        double      stddev = 0.0;
+        double      p99    = 0.0;
+    };
+
+    auto endsWith(const std::string& text, const std::string& suffix)
+        -> bool {
+        return text.size() >= suffix.size() &&
+               text.compare(text.size() - suffix.size(), suffix.size(),
+                            suffix) == 0;
+    }
+
+    // Several instances may share a name; keep the busiest
+    void addEntry(std::map<std::string, Entry>& entries, const Entry& entry) {
+        auto it = entries.find(entry.name);
+        if (it == entries.end() || it->second.runs < entry.runs) {
+            entries[entry.name] = entry;
+        }
+    }
+
+    auto readCsv(std::ifstream& file, const std::string& path)
+        -> std::map<std::string, Entry> {
+        std::map<std::string, std::size_t> columns;
+        std::map<std::string, Entry>       entries;
+        std::string                        line;
+        while (std::getline(file, line)) {
+            if (line.empty() || line[0] == '#') {
+                continue;  // Metadata
+            }
+            auto fields = simlab::benchmark::splitCsv(line);
+            if (columns.empty()) {
+                for (std::size_t i = 0; i < fields.size(); i++) {
+                    columns[fields[i]] = i;
+                }
+                for (const char* required :
+                     {"name", "runs", "mean_ms", "stddev_ms", "p99_ms"}) {
+                    if (columns.count(required) == 0) {
+                        throw std::runtime_error(path + ": missing column " +
+                                                 required);
+                    }
+                }
+                continue;
+            }
+            if (fields.size() < columns.size()) {
+                throw std::runtime_error(path + ": short row: " + line);
+            }
+
+            Entry entry;
+            entry.name   = fields[columns["name"]];
+            entry.runs   = std::stod(fields[columns["runs"]]);
+            entry.mean   = std::stod(fields[columns["mean_ms"]]);
+            entry.stddev = std::stod(fields[columns["stddev_ms"]]);
+            entry.p99    = std::stod(fields[columns["p99_ms"]]);
+            addEntry(entries, entry);
+        }
+        return entries;
+    }
+
+    /**
+     * @brief Just enough JSON for Benchmark::exportJson
+     * Objects, arrays, strings and bare numbers (fmt writes nan and inf
+     * unquoted, which std::stod still accepts)
+     */
+    class JsonReader {
+      public:
+
+        JsonReader(std::string text, const std::string& path)
+            : m_text(std::move(text)), m_path(path) {}
+
+        auto peek() -> char {
+            while (m_pos < m_text.size() &&
+                   std::isspace(static_cast<unsigned char>(m_text[m_pos]))) {
+                m_pos++;
+            }
+            return m_pos < m_text.size() ? m_text[m_pos] : '\0';
+        }
+
+        // Consumes c if it is next
+        auto accept(char c) -> bool {
+            if (peek() != c) {
+                return false;
+            }
+            m_pos++;
+            return true;
+        }
+
+        void expect(char c) {
+            if (!accept(c)) {
+                throw std::runtime_error(fmt::format(
+                    "{}: expected '{}' at offset {}", m_path, c, m_pos));
+            }
+        }
+
+        auto readString() -> std::string {
+            expect('"');
+            std::string text;
+            while (m_pos < m_text.size() && m_text[m_pos] != '"') {
+                char c = m_text[m_pos++];
+                if (c != '\\' || m_pos >= m_text.size()) {
+                    text += c;
+                    continue;
+                }
+                char escaped = m_text[m_pos++];
+                if (escaped == 'n') {
+                    text += '\n';
+                } else if (escaped == 'u') {
+                    text += static_cast<char>(
+                        std::stoi(m_text.substr(m_pos, 4), nullptr, 16));
+                    m_pos += 4;
+                } else {
+                    text += escaped;
+                }
+            }
+            expect('"');
+            return text;
+        }
+
+        // Bare token up to the next separator: a number, true/false/null
+        auto readToken() -> std::string {
+            peek();
+            std::size_t end = m_text.find_first_of(",}] \t\r\n", m_pos);
+            end             = end == std::string::npos ? m_text.size() : end;
+            std::string token = m_text.substr(m_pos, end - m_pos);
+            m_pos             = end;
+            if (token.empty()) {
+                throw std::runtime_error(fmt::format(
+                    "{}: expected a value at offset {}", m_path, m_pos));
+            }
+            return token;
+        }
+
+        void skipValue() {
+            char c = peek();
+            if (c == '"') {
+                readString();
+            } else if (accept('{')) {
+                while (!accept('}')) {
+                    readString();
+                    expect(':');
+                    skipValue();
+                    accept(',');
+                }
+            } else if (accept('[')) {
+                while (!accept(']')) {
+                    skipValue();
+                    accept(',');
+                }
+            } else {
+                readToken();
+            }
+        }
+
+      private:
+
+        std::string        m_text;
+        const std::string& m_path;
+        std::size_t        m_pos = 0;
+    };
+
+    auto readJson(std::ifstream& file, const std::string& path)
+        -> std::map<std::string, Entry> {
+        std::stringstream buffer;
+        buffer << file.rdbuf();
+        JsonReader json(buffer.str(), path);
+
+        std::map<std::string, Entry> entries;
+        json.expect('{');
+        while (!json.accept('}')) {
+            std::string key = json.readString();
+            json.expect(':');
+            if (key != "benchmarks") {
+                json.skipValue();
+                json.accept(',');
+                continue;
+            }
+
+            json.expect('[');
+            while (!json.accept(']')) {
+                std::string                   name;
+                std::map<std::string, double> values;
+                json.expect('{');
+                while (!json.accept('}')) {
+                    std::string field = json.readString();
+                    json.expect(':');
+                    if (field == "name") {
+                        name = json.readString();
+                    } else if (json.peek() == '"') {
+                        json.readString();
+                    } else {
+                        values[field] = std::stod(json.readToken());
+                    }
+                    json.accept(',');
+                }
+
+                for (const char* required :
+                     {"runs", "mean_ms", "stddev_ms", "p99_ms"}) {
+                    if (values.count(required) == 0) {
+                        throw std::runtime_error(
+                            fmt::format("{}: benchmark '{}' has no {}", path,
+                                        name, required));
+                    }
+                }
+                Entry entry;
+                entry.name   = name;
+                entry.runs   = values["runs"];
+                entry.mean   = values["mean_ms"];
+                entry.stddev = values["stddev_ms"];
+                entry.p99    = values["p99_ms"];
+                addEntry(entries, entry);
+                json.accept(',');
+            }
+            json.accept(',');
+        }
+        return entries;
+    }
+
+    auto readExport(const std::string& path) -> std::map<std::string, Entry> {
+        std::ifstream file(path);
+        if (!file.is_open()) {
+            throw std::runtime_error("Cannot open " + path);
+        }
+        return endsWith(path, ".json") ? readJson(file, path)
+                                       : readCsv(file, path);
+    }
+
+    /**
+     * @brief One-sided Welch t-test p-value for "current is slower"
+     * Small p means the current mean is significantly larger
+     */
+    auto welchPValue(const Entry& base, const Entry& current) -> double {
+        if (base.runs < 2 || current.runs < 2) {
+            return 1.0;
+        }
+        double varBase    = base.stddev * base.stddev / base.runs;
+        double varCurrent = current.stddev * current.stddev / current.runs;
+        double variance   = varBase + varCurrent;
+        if (variance <= 0.0) {
+            return current.mean > base.mean ? 0.0 : 1.0;
+        }
+
+        double t  = (current.mean - base.mean) / std::sqrt(variance);
+        double df = variance * variance /
+                    ((varBase * varBase / (base.runs - 1)) +
+                     (varCurrent * varCurrent / (current.runs - 1)));
+
+        // Upper tail, P(T >= t), without cancellation for tiny p
+        return simlab::benchmark::studentCdf(-t, df);
+    }
+
+    void printUsage() {
+        fmt::print(stderr,
+                   "Usage: bench_compare <baseline> <current> "
+                   "[--threshold 0.05] [--alpha 0.01]\n"
+                   "Exports ending in .json are read as JSON, others as "
+                   "CSV\n");
+    }
+}  // namespace
+
+auto main(int argc, char** argv) -> int {
+    std::vector<std::string> paths;
+    double                   threshold = 0.05;
+    double                   alpha     = 0.01;
+
+    try {
+        for (int i = 1; i < argc; i++) {
+            std::string arg = argv[i];
+            if (arg == "--threshold" && i + 1 < argc) {
+                threshold = std::stod(argv[++i]);
+            } else if (arg == "--alpha" && i + 1 < argc) {
+                alpha = std::stod(argv[++i]);
+            } else {
+                paths.push_back(arg);
+            }
+        }
+    } catch (const std::exception&) {
+        printUsage();
+        return 2;
+    }
+    if (paths.size() != 2) {
+        printUsage();
+        return 2;
+    }
+
+    std::map<std::string, Entry> baseline;
+    std::map<std::string, Entry> current;
+    try {
+        baseline = readExport(paths[0]);
+        current  = readExport(paths[1]);
+    } catch (const std::exception& e) {
+        fmt::print(stderr, "bench_compare: {}\n", e.what());
+        return 2;
+    }
+
+    fmt::print("{:<32} {:>12} {:>12} {:>9} {:>12} {:>10}\n", "Benchmark",
+               "base (ms)", "current (ms)", "change", "p99 change", "p-value");
+
+    int regressions = 0;
+    for (const auto& [name, base] : baseline) {
+        auto it = current.find(name);
+        if (it == current.end()) {
+            fmt::print(fg(fmt::color::gray), "{:<32} missing in current\n",
+                       name);
+            continue;
+        }
+        const Entry& now = it->second;
+
+        double change    = base.mean > 0.0 ? (now.mean / base.mean) - 1.0 : 0.0;
+        double p99Change = base.p99 > 0.0 ? (now.p99 / base.p99) - 1.0 : 0.0;
+        double slower    = welchPValue(base, now);
+        double faster    = welchPValue(now, base);
+
+        auto color = fmt::color::light_sea_green;
+        auto label = "";
+        if (change > threshold && slower < alpha) {
+            color = fmt::color::red;
+            label = "  REGRESSION";
+            regressions++;
+        } else if (change < -threshold && faster < alpha) {
+            color = fmt::color::green;
+            label = "  improved";
+        }
+        fmt::print(fg(color),
+                   "{:<32} {:>12.4f} {:>12.4f} {:>+8.1f}% {:>+11.1f}% "
+                   "{:>10.2g}{}\n",
+                   name, base.mean, now.mean, change * 100.0,
+                   p99Change * 100.0, std::min(slower, faster), label);
+    }
+    for (const auto& [name, entry] : current) {
+        if (baseline.count(name) == 0) {
+            fmt::print(fg(fmt::color::gray), "{:<32} new (no baseline)\n",
+                       name);
+        }
+    }
+
+    if (regressions != 0) {
+        fmt::print(fg(fmt::color::red), "\n{} regression(s) found\n",
+                   regressions);
+        return 1;
+    }
+    return 0;
+}
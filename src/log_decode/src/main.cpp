@@ -0,0 +1,243 @@
+// Print a binary log written by Logger::setBinaryLogFile as text.
+//
+//   log_decode <file.simlog> [--sites]
+//
+// Records are formatted from their site's format string and argument
+// signature (see simlab/logger/BinaryFormat.hpp), so the types do not
+// have to be known at compile time. --sites also lists every call site.
+// Exit code is 2 on bad input; a truncated tail is reported, not fatal.
+
+#include "simlab/logger/BinaryFormat.hpp"
+
+#include <fmt/args.h>
+#include <fmt/core.h>
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+    struct Site {
+        std::string              format;
+        std::string              file;
+        std::uint32_t            line = 0;
+        std::vector<std::string> codes;
+    };
+
+    // Bounds-checked cursor over the whole file
+    class Reader {
+      public:
+
+        explicit Reader(std::string data) : m_data(std::move(data)) {}
+
+        auto atEnd() const -> bool {
+            return m_pos >= m_data.size();
+        }
+
+        template <typename T>
+        auto read() -> T {
+            T value;
+            std::memcpy(&value, take(sizeof(T)), sizeof(T));
+            return value;
+        }
+
+        auto readString() -> std::string {
+            auto length = read<std::uint16_t>();
+            return {take(length), length};
+        }
+
+        auto position() const -> std::size_t {
+            return m_pos;
+        }
+
+      private:
+
+        auto take(std::size_t size) -> const char* {
+            if (m_data.size() - m_pos < size) {
+                throw std::runtime_error("truncated entry");
+            }
+            const char* data = m_data.data() + m_pos;
+            m_pos += size;
+            return data;
+        }
+
+        std::string m_data;
+        std::size_t m_pos = 0;
+    };
+
+    auto splitCodes(const std::string& signature) -> std::vector<std::string> {
+        std::vector<std::string> codes;
+        std::size_t              start = 0;
+        while (start < signature.size()) {
+            std::size_t end = signature.find(',', start);
+            end             = end == std::string::npos ? signature.size() : end;
+            codes.push_back(signature.substr(start, end - start));
+            start = end + 1;
+        }
+        return codes;
+    }
+
+    void pushArg(fmt::dynamic_format_arg_store<fmt::format_context>& store,
+                 const std::string& code, Reader& payload) {
+        if (code == "s") {
+            store.push_back(payload.readString());
+        } else if (code == "b1") {
+            store.push_back(payload.read<bool>());
+        } else if (code == "c1") {
+            store.push_back(payload.read<char>());
+        } else if (code == "i1") {
+            store.push_back(payload.read<std::int8_t>());
+        } else if (code == "i2") {
+            store.push_back(payload.read<std::int16_t>());
+        } else if (code == "i4") {
+            store.push_back(payload.read<std::int32_t>());
+        } else if (code == "i8") {
+            store.push_back(payload.read<std::int64_t>());
+        } else if (code == "u1") {
+            store.push_back(payload.read<std::uint8_t>());
+        } else if (code == "u2") {
+            store.push_back(payload.read<std::uint16_t>());
+        } else if (code == "u4") {
+            store.push_back(payload.read<std::uint32_t>());
+        } else if (code == "u8") {
+            store.push_back(payload.read<std::uint64_t>());
+        } else if (code == "f4") {
+            store.push_back(payload.read<float>());
+        } else if (code == "f8") {
+            store.push_back(payload.read<double>());
+        } else if (code == "f16") {
+            store.push_back(payload.read<long double>());
+        } else if (code == "p8") {
+            store.push_back(fmt::format(
+                "{:#x}", payload.read<std::uint64_t>()));
+        } else if (code.size() > 1 && code[0] == 'x') {
+            // Opaque trivially copyable value, shown as its bytes
+            std::size_t size = std::stoul(code.substr(1));
+            std::string hex;
+            for (std::size_t i = 0; i < size; i++) {
+                hex += fmt::format("{:02x}", payload.read<std::uint8_t>());
+            }
+            store.push_back(hex);
+        } else {
+            throw std::runtime_error("unknown type code '" + code + "'");
+        }
+    }
+
+    auto formatRecord(const Site& site, const std::string& payload)
+        -> std::string {
+        fmt::dynamic_format_arg_store<fmt::format_context> store;
+        Reader                                             reader(payload);
+        for (const auto& code : site.codes) {
+            pushArg(store, code, reader);
+        }
+        return fmt::vformat(site.format, store);
+    }
+
+    auto levelName(std::uint8_t level) -> const char* {
+        constexpr const char* Names[] = {"DEBUG", "INFO", "WARN", "ERROR",
+                                         "FATAL"};
+        return level < std::size(Names) ? Names[level] : "UNKNOWN";
+    }
+
+    void printUsage() {
+        fmt::print(stderr, "usage: log_decode <file.simlog> [--sites]\n");
+    }
+}  // namespace
+
+auto main(int argc, char** argv) -> int {
+    std::string path;
+    bool        listSites = false;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--sites") {
+            listSites = true;
+        } else if (path.empty()) {
+            path = arg;
+        } else {
+            printUsage();
+            return 2;
+        }
+    }
+    if (path.empty()) {
+        printUsage();
+        return 2;
+    }
+
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        fmt::print(stderr, "log_decode: cannot open {}\n", path);
+        return 2;
+    }
+    Reader reader(std::string(std::istreambuf_iterator<char>(file), {}));
+
+    namespace Binary = Logger::Binary;
+    try {
+        for (char expected : Binary::FileMagic) {
+            if (reader.read<char>() != expected) {
+                throw std::runtime_error("not a binary log");
+            }
+        }
+    } catch (const std::exception& e) {
+        fmt::print(stderr, "log_decode: {}: {}\n", path, e.what());
+        return 2;
+    }
+
+    std::map<std::uint32_t, Site> sites;
+    std::size_t                   records = 0;
+    try {
+        while (!reader.atEnd()) {
+            auto tag = reader.read<Binary::EntryTag>();
+            if (tag == Binary::EntryTag::Site) {
+                auto  id   = reader.read<std::uint32_t>();
+                Site& site = sites[id];
+                site.line  = reader.read<std::uint32_t>();
+                site.format = reader.readString();
+                site.file   = reader.readString();
+                site.codes  = splitCodes(reader.readString());
+                if (listSites) {
+                    fmt::print("# site {} {}:{} \"{}\"\n", id, site.file,
+                               site.line, site.format);
+                }
+                continue;
+            }
+            if (tag != Binary::EntryTag::Record) {
+                throw std::runtime_error(
+                    fmt::format("bad entry tag at byte {}",
+                                reader.position() - 1));
+            }
+
+            auto        id      = reader.read<std::uint32_t>();
+            auto        level   = reader.read<std::uint8_t>();
+            auto        ns      = reader.read<std::int64_t>();
+            std::string payload = reader.readString();
+            records++;
+
+            std::string message;
+            auto        it = sites.find(id);
+            if (id == 0) {
+                message = payload;
+            } else if (it == sites.end()) {
+                message = fmt::format("<unknown site {}>", id);
+            } else {
+                try {
+                    message = formatRecord(it->second, payload);
+                } catch (const std::exception& e) {
+                    message = fmt::format("<{}: \"{}\">", e.what(),
+                                          it->second.format);
+                }
+            }
+            fmt::print("[{}] [{}.{:09}] {}\n", levelName(level),
+                       ns / 1'000'000'000, ns % 1'000'000'000, message);
+        }
+    } catch (const std::exception& e) {
+        fmt::print(stderr, "log_decode: {}: {} after {} records\n", path,
+                   e.what(), records);
+    }
+    return 0;
+}
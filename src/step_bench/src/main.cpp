@@ -0,0 +1,121 @@
+// Headless scaling runs of the simulation steps through BenchmarkRunner.
+//
+//   step_bench [--csv results.csv] [--repetitions 15] [--steps 200]
+//              [--warmup 100] [--seed 42]
+//
+// Prints per-size step time with confidence intervals and the scaling
+// exponent; --csv writes a file bench_compare can diff against a baseline.
+
+#include "simlab/core/Automata.hpp"
+#include "simlab/core/BenchmarkRunner.hpp"
+#include "simlab/core/Random.hpp"
+
+#include <fmt/core.h>
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+    using simlab::Automata;
+    using simlab::BenchmarkRunner;
+
+    auto lifeSetup(simlab::LifeRule rule, float density)
+        -> BenchmarkRunner::Setup {
+        return [rule, density](std::size_t size, std::uint64_t seed)
+                   -> BenchmarkRunner::StepFunction {
+            struct State {
+                Automata::Grid grid;
+                Automata::Grid next;
+            };
+            auto state  = std::make_shared<State>();
+            state->grid = Automata::randomGrid(size, density, seed);
+            return [state, rule](float /*dt*/) -> void {
+                Automata::lifeStep(state->grid, state->next, rule);
+                state->grid.swap(state->next);
+            };
+        };
+    }
+
+    auto elementarySetup(std::size_t size, std::uint64_t seed)
+        -> BenchmarkRunner::StepFunction {
+        struct State {
+            std::vector<bool> states;
+            std::vector<bool> next;
+        };
+        auto state = std::make_shared<State>();
+        state->states.resize(size);
+
+        simlab::Random random(seed);
+        for (auto&& cell : state->states) {
+            cell = random.chance(0.5);
+        }
+        return [state](float /*dt*/) -> void {
+            Automata::elementaryStep(30, state->states, state->next);
+            state->states.swap(state->next);
+        };
+    }
+
+    void usage() {
+        fmt::print(stderr,
+                   "usage: step_bench [--csv results.csv] [--repetitions N] "
+                   "[--steps N] [--warmup N] [--seed N]\n");
+    }
+}  // namespace
+
+auto main(int argc, char** argv) -> int {
+    BenchmarkRunner::Config config;
+    std::string             csvPath;
+    try {
+        for (int i = 1; i < argc; i++) {
+            std::string arg = argv[i];
+            if (arg == "--csv" && i + 1 < argc) {
+                csvPath = argv[++i];
+            } else if (arg == "--repetitions" && i + 1 < argc) {
+                config.repetitions = std::stoul(argv[++i]);
+            } else if (arg == "--steps" && i + 1 < argc) {
+                config.stepsPerRepetition = std::stoul(argv[++i]);
+            } else if (arg == "--warmup" && i + 1 < argc) {
+                config.warmupSteps = std::stoul(argv[++i]);
+            } else if (arg == "--seed" && i + 1 < argc) {
+                config.seed = std::stoull(argv[++i]);
+            } else {
+                usage();
+                return 2;
+            }
+        }
+
+        BenchmarkRunner runner(config);
+        std::vector<BenchmarkRunner::Result> all;
+
+        auto runSweep = [&](const std::string&              name,
+                            const BenchmarkRunner::Setup&   setup,
+                            const std::vector<std::size_t>& sizes) {
+            auto results = runner.sweep(name, setup, sizes);
+            for (const auto& result : results) {
+                BenchmarkRunner::report(result);
+            }
+            BenchmarkRunner::reportScaling(results);
+            all.insert(all.end(), results.begin(), results.end());
+        };
+
+        runSweep("lifeStep/conway",
+                 lifeSetup(simlab::LifeRule::conway(), 0.25F),
+                 {64, 128, 256, 512});
+        runSweep("lifeStep/maze", lifeSetup(simlab::LifeRule::maze(), 0.12F),
+                 {64, 128, 256, 512});
+        runSweep("elementaryStep/30", elementarySetup,
+                 {1024, 4096, 16384, 65536});
+
+        if (!csvPath.empty()) {
+            BenchmarkRunner::exportCsv(csvPath, all);
+            fmt::print("\nWrote {}\n", csvPath);
+        }
+    } catch (const std::exception& e) {
+        fmt::print(stderr, "step_bench: {}\n", e.what());
+        return 2;
+    }
+    return 0;
+}